@@ -0,0 +1,111 @@
+#include "StrafeMovementBatch.h"
+#include "Math/VectorRegister.h"
+
+void FStrafeMovementBatch::Reset()
+{
+    NumLanes = 0;
+    for (FLaneArray* Lanes : { &VelX, &VelY, &VelZ, &WishX, &WishY, &WishSpeed, &Accel, &Friction, &StopSpeed, &MaxGroundSpeed, &Gravity, &GroundControl })
+    {
+        Lanes->Reset();
+    }
+}
+
+int32 FStrafeMovementBatch::Add(const FVector& Velocity, const FVector& WishDirection, float InWishSpeed, const FStrafeMoveParams& Params, bool bOnGround, bool bJustLanded)
+{
+    // Padding lanes appended by a previous Integrate are overwritten from here on.
+    for (FLaneArray* Lanes : { &VelX, &VelY, &VelZ, &WishX, &WishY, &WishSpeed, &Accel, &Friction, &StopSpeed, &MaxGroundSpeed, &Gravity, &GroundControl })
+    {
+        Lanes->SetNum(NumLanes, EAllowShrinking::No);
+    }
+
+    VelX.Add(Velocity.X);
+    VelY.Add(Velocity.Y);
+    VelZ.Add(Velocity.Z);
+    WishX.Add(WishDirection.X);
+    WishY.Add(WishDirection.Y);
+    WishSpeed.Add(InWishSpeed);
+    Accel.Add(bOnGround ? Params.GroundAccelerationFactor : Params.AirAccelerationFactor);
+    Friction.Add(Params.GroundFrictionFactor);
+    StopSpeed.Add(Params.GroundStopSpeed);
+    MaxGroundSpeed.Add(Params.MaxGroundSpeed);
+    Gravity.Add(bOnGround ? 0.f : Params.GravityZ);
+    GroundControl.Add(bOnGround && !bJustLanded ? 1.f : 0.f);
+    return NumLanes++;
+}
+
+void FStrafeMovementBatch::AddPaddingLane()
+{
+    // An inert lane: no velocity, no wish, no friction, so every operation on it is a no-op.
+    for (FLaneArray* Lanes : { &VelX, &VelY, &VelZ, &WishX, &WishY, &WishSpeed, &Accel, &Friction, &StopSpeed, &MaxGroundSpeed, &Gravity, &GroundControl })
+    {
+        Lanes->Add(0.f);
+    }
+}
+
+void FStrafeMovementBatch::Integrate(float DeltaTime)
+{
+    if (NumLanes == 0 || DeltaTime <= 0.f)
+    {
+        return;
+    }
+
+    while (VelX.Num() % 4 != 0)
+    {
+        AddPaddingLane();
+    }
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOneFloat();
+    const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+
+    for (int32 Lane = 0; Lane < VelX.Num(); Lane += 4)
+    {
+        VectorRegister4Float Vx = VectorLoadAligned(&VelX[Lane]);
+        VectorRegister4Float Vy = VectorLoadAligned(&VelY[Lane]);
+        VectorRegister4Float Vz = VectorLoadAligned(&VelZ[Lane]);
+        const VectorRegister4Float Wx = VectorLoadAligned(&WishX[Lane]);
+        const VectorRegister4Float Wy = VectorLoadAligned(&WishY[Lane]);
+        const VectorRegister4Float Ws = VectorLoadAligned(&WishSpeed[Lane]);
+        const VectorRegister4Float ControlMask = VectorCompareGT(VectorLoadAligned(&GroundControl[Lane]), Zero);
+
+        // Friction (PM_Friction): scale = max(speed - max(speed, stop) * friction * dt, 0) / speed, snapping below 1 uu/s.
+        {
+            const VectorRegister4Float Speed = VectorSqrt(VectorMultiplyAdd(Vx, Vx, VectorMultiply(Vy, Vy)));
+            const VectorRegister4Float Control = VectorMax(Speed, VectorLoadAligned(&StopSpeed[Lane]));
+            const VectorRegister4Float Drop = VectorMultiply(VectorMultiply(Control, VectorLoadAligned(&Friction[Lane])), Dt);
+            VectorRegister4Float Scale = VectorDivide(VectorMax(VectorSubtract(Speed, Drop), Zero), VectorMax(Speed, One));
+            Scale = VectorSelect(VectorCompareLT(Speed, One), Zero, Scale);
+            Scale = VectorSelect(ControlMask, Scale, One);
+            Vx = VectorMultiply(Vx, Scale);
+            Vy = VectorMultiply(Vy, Scale);
+        }
+
+        // Acceleration (PM_Accelerate): add min(accel * dt * wishspeed, wishspeed - v.wishdir) when positive.
+        // v.wishdir is the XY dot product, as in StrafePhysics::ApplyAcceleration for both ground and air.
+        {
+            const VectorRegister4Float CurrentSpeed = VectorMultiplyAdd(Vx, Wx, VectorMultiply(Vy, Wy));
+            const VectorRegister4Float AddSpeed = VectorSubtract(Ws, CurrentSpeed);
+            const VectorRegister4Float MaxAccel = VectorMultiply(VectorMultiply(VectorLoadAligned(&Accel[Lane]), Dt), Ws);
+            const VectorRegister4Float AccelSpeed = VectorMax(VectorMin(MaxAccel, AddSpeed), Zero);
+            Vx = VectorMultiplyAdd(AccelSpeed, Wx, Vx);
+            Vy = VectorMultiplyAdd(AccelSpeed, Wy, Vy);
+        }
+
+        // Ground speed clamp.
+        {
+            const VectorRegister4Float MaxSpeed = VectorLoadAligned(&MaxGroundSpeed[Lane]);
+            const VectorRegister4Float SpeedSquared = VectorMultiplyAdd(Vx, Vx, VectorMultiply(Vy, Vy));
+            const VectorRegister4Float OverMask = VectorBitwiseAnd(ControlMask, VectorCompareGT(SpeedSquared, VectorMultiply(MaxSpeed, MaxSpeed)));
+            const VectorRegister4Float Scale = VectorSelect(OverMask, VectorDivide(MaxSpeed, VectorSqrt(VectorMax(SpeedSquared, One))), One);
+            Vx = VectorMultiply(Vx, Scale);
+            Vy = VectorMultiply(Vy, Scale);
+        }
+
+        // Gravity (zero for grounded lanes).
+        Vz = VectorMultiplyAdd(VectorLoadAligned(&Gravity[Lane]), Dt, Vz);
+
+        VectorStoreAligned(Vx, &VelX[Lane]);
+        VectorStoreAligned(Vy, &VelY[Lane]);
+        VectorStoreAligned(Vz, &VelZ[Lane]);
+    }
+}
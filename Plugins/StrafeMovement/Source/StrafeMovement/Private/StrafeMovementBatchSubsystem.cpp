@@ -0,0 +1,114 @@
+#include "StrafeMovementBatchSubsystem.h"
+#include "StrafeMovementComponent.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+
+void FStrafeMovementBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Target && TickType != LEVELTICK_ViewportsOnly)
+    {
+        Target->RunBatch(DeltaTime);
+    }
+}
+
+FString FStrafeMovementBatchTickFunction::DiagnosticMessage()
+{
+    return TEXT("FStrafeMovementBatchTickFunction");
+}
+
+bool UStrafeMovementBatchSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UStrafeMovementBatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    BatchTickFunction.Target = this;
+    BatchTickFunction.TickGroup = TG_PrePhysics;
+    BatchTickFunction.bCanEverTick = true;
+    BatchTickFunction.bStartWithTickEnabled = true;
+    BatchTickFunction.bRunOnAnyThread = false;
+    BatchTickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+}
+
+void UStrafeMovementBatchSubsystem::Deinitialize()
+{
+    for (const TWeakObjectPtr<UStrafeMovementComponent>& Component : RegisteredComponents)
+    {
+        if (Component.IsValid())
+        {
+            Component->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+        }
+    }
+    RegisteredComponents.Reset();
+
+    BatchTickFunction.UnRegisterTickFunction();
+    BatchTickFunction.Target = nullptr;
+    Super::Deinitialize();
+}
+
+void UStrafeMovementBatchSubsystem::RegisterComponent(UStrafeMovementComponent* Component)
+{
+    if (Component && !RegisteredComponents.Contains(Component))
+    {
+        RegisteredComponents.Add(Component);
+        Component->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+    }
+}
+
+void UStrafeMovementBatchSubsystem::UnregisterComponent(UStrafeMovementComponent* Component)
+{
+    if (Component && RegisteredComponents.RemoveSingleSwap(Component) > 0)
+    {
+        Component->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+    }
+}
+
+void UStrafeMovementBatchSubsystem::RunBatch(float DeltaTime)
+{
+    Batch.Reset();
+    BatchedComponents.Reset();
+
+    for (int32 Index = RegisteredComponents.Num() - 1; Index >= 0; --Index)
+    {
+        UStrafeMovementComponent* Component = RegisteredComponents[Index].Get();
+        if (!Component)
+        {
+            RegisteredComponents.RemoveAtSwap(Index);
+            continue;
+        }
+
+        // Movers with their own time dilation tick with a different delta; leave them on the scalar path.
+        if (Component->GetOwner()->CustomTimeDilation != 1.f)
+        {
+            continue;
+        }
+
+        FVector WishDirection;
+        float WishSpeed = 0.f;
+        bool bOnGround = false;
+        if (!Component->GatherBatchInput(DeltaTime, WishDirection, WishSpeed, bOnGround))
+        {
+            continue;
+        }
+
+        Batch.Add(Component->Velocity, WishDirection, WishSpeed, Component->GetStrafeMoveParams(), bOnGround, Component->GetIsJustLandedFrame());
+        BatchedComponents.Add(Component);
+    }
+
+    LastBatchSize = BatchedComponents.Num();
+    if (LastBatchSize == 0)
+    {
+        return;
+    }
+
+    Batch.Integrate(DeltaTime);
+
+    for (int32 Lane = 0; Lane < BatchedComponents.Num(); ++Lane)
+    {
+        BatchedComponents[Lane]->ReceiveBatchedVelocity(Batch.GetVelocity(Lane));
+    }
+}
@@ -1,8 +1,12 @@
 ﻿#include "StrafeMovementComponent.h"
 #include "GameFramework/Character.h"
 #include "Components/CapsuleComponent.h" // Required for GetCapsuleComponent()
+#include "Components/SkeletalMeshComponent.h"
 #include "Net/UnrealNetwork.h" 
 #include "Engine/World.h"     
+#include "StrafeMovementBatchSubsystem.h"
+#include "Math/Float16.h"
+#include "GameFramework/PlayerState.h"
 
 // FSavedMove_Strafe and FNetworkPredictionData_Client_Strafe implementations (same as before) ...
 #pragma region FSavedMove_Strafe
@@ -22,6 +26,8 @@ uint8 FSavedMove_Strafe::GetCompressedFlags() const
 
 bool FSavedMove_Strafe::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
 {
+    // Super compares wish directions against AccelDotThresholdCombine, which SetMoveFor derives from the
+    // component's angular tolerance.
     if (!Super::CanCombineWith(NewMove, InCharacter, MaxDelta))
     {
         return false;
@@ -35,7 +41,43 @@ bool FSavedMove_Strafe::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter*
     {
         return false;
     }
-    return true;
+
+    const UStrafeMovementComponent* StrafeComp = InCharacter ? Cast<UStrafeMovementComponent>(InCharacter->GetCharacterMovement()) : nullptr;
+    if (!StrafeComp)
+    {
+        return true;
+    }
+
+    // Quake movement is frame-rate dependent, so only combine when one long step reaches the same velocity as
+    // the two short ones. A combined move is replayed with the new move's acceleration over both delta times.
+    const EMovementMode StartMode = static_cast<EMovementMode>(StartPackedMovementMode & 0x0F);
+    if (StartMode != MOVE_Walking && StartMode != MOVE_Falling)
+    {
+        return true;
+    }
+
+    const FStrafeMoveParams Params = StrafeComp->GetStrafeMoveParams();
+    FStrafeKinematicState StartState;
+    StartState.Velocity = StartVelocity;
+    StartState.bOnGround = StartMode == MOVE_Walking;
+    StartState.bJustLanded = bSavedJustLandedFrame;
+
+    FStrafeMoveInput PendingInput;
+    PendingInput.WishDirection = AccelNormal;
+    PendingInput.WishSpeed = AccelNormal.IsZero() ? 0.f : Params.MaxWishSpeed;
+    FStrafeMoveInput NewInput;
+    NewInput.WishDirection = NewStrafeMove->AccelNormal;
+    NewInput.WishSpeed = NewStrafeMove->AccelNormal.IsZero() ? 0.f : Params.MaxWishSpeed;
+
+    FStrafeKinematicState Separate = StartState;
+    StrafePhysics::Step(Separate, PendingInput, Params, DeltaTime);
+    // Only the first grounded step of a landing skips friction.
+    StrafePhysics::Step(Separate, NewInput, Params, NewStrafeMove->DeltaTime);
+
+    FStrafeKinematicState Combined = StartState;
+    StrafePhysics::Step(Combined, NewInput, Params, DeltaTime + NewStrafeMove->DeltaTime);
+
+    return FVector::DistSquared(Separate.Velocity, Combined.Velocity) <= FMath::Square(StrafeComp->MoveCombineMaxVelocityError);
 }
 
 void FSavedMove_Strafe::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
@@ -44,6 +86,7 @@ void FSavedMove_Strafe::SetMoveFor(ACharacter* C, float InDeltaTime, FVector con
     UStrafeMovementComponent* StrafeComp = Cast<UStrafeMovementComponent>(C->GetCharacterMovement());
     if (StrafeComp)
     {
+        AccelDotThresholdCombine = FMath::Cos(FMath::DegreesToRadians(StrafeComp->MoveCombineAngleToleranceDegrees));
         bSavedStrafeJumpHeld = StrafeComp->GetIsStrafeJumpHeld();
         bSavedJustLandedFrame = StrafeComp->GetIsJustLandedFrame();
     }
@@ -78,6 +121,98 @@ FSavedMovePtr FNetworkPredictionData_Client_Strafe::AllocateNewMove()
 
 #pragma endregion FNetworkPredictionData_Client_Strafe
 
+#pragma region FStrafeNetworkMoveData
+
+void FStrafeNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+    Super::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+    const FSavedMove_Strafe& StrafeMove = static_cast<const FSavedMove_Strafe&>(ClientMove);
+    bStrafeJumpHeld = StrafeMove.bSavedStrafeJumpHeld;
+    bJustLandedFrame = StrafeMove.bSavedJustLandedFrame;
+}
+
+bool FStrafeNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+    // Same layout as FCharacterNetworkMoveData::Serialize apart from the acceleration and the two strafe bits.
+    NetworkMoveType = MoveType;
+
+    bool bLocalSuccess = true;
+    const bool bIsSaving = Ar.IsSaving();
+
+    Ar << TimeStamp;
+
+    SerializeAcceleration(Ar, PackageMap, bLocalSuccess);
+
+    Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
+
+    ControlRotation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+
+    SerializeOptionalValue<uint8>(bIsSaving, Ar, CompressedMoveFlags, 0);
+
+    uint8 StrafeBits = (bStrafeJumpHeld ? 1 : 0) | (bJustLandedFrame ? 2 : 0);
+    Ar.SerializeBits(&StrafeBits, 2);
+    bStrafeJumpHeld = (StrafeBits & 1) != 0;
+    bJustLandedFrame = (StrafeBits & 2) != 0;
+
+    if (MoveType == ENetworkMoveType::NewMove)
+    {
+        // Movement base and ending movement mode are only used for error checking, so only save for the final move.
+        SerializeOptionalValue<UPrimitiveComponent*>(bIsSaving, Ar, MovementBase, nullptr);
+        SerializeOptionalValue<FName>(bIsSaving, Ar, MovementBaseBoneName, NAME_None);
+        SerializeOptionalValue<uint8>(bIsSaving, Ar, MovementMode, MOVE_Walking);
+    }
+
+    return !Ar.IsError() && bLocalSuccess;
+}
+
+void FStrafeNetworkMoveData::SerializeAcceleration(FArchive& Ar, UPackageMap* PackageMap, bool& bOutSuccess)
+{
+    // 1 bit: zero acceleration. 1 bit: horizontal. Horizontal: 16-bit yaw + 16-bit float magnitude (34 bits total),
+    // otherwise the engine's quantized vector.
+    uint8 bHasAcceleration = !Acceleration.IsZero();
+    Ar.SerializeBits(&bHasAcceleration, 1);
+    if (!bHasAcceleration)
+    {
+        Acceleration = FVector_NetQuantize10(FVector::ZeroVector);
+        return;
+    }
+
+    uint8 bPlanar = Acceleration.Z == 0.f;
+    Ar.SerializeBits(&bPlanar, 1);
+    if (!bPlanar)
+    {
+        Acceleration.NetSerialize(Ar, PackageMap, bOutSuccess);
+        return;
+    }
+
+    uint16 Yaw = 0;
+    FFloat16 Magnitude;
+    if (Ar.IsSaving())
+    {
+        Yaw = FRotator::CompressAxisToShort(FMath::RadiansToDegrees(FMath::Atan2(Acceleration.Y, Acceleration.X)));
+        Magnitude = FFloat16(static_cast<float>(Acceleration.Size2D()));
+    }
+    Ar << Yaw;
+    Ar << Magnitude;
+    if (Ar.IsLoading())
+    {
+        float SinYaw, CosYaw;
+        FMath::SinCos(&SinYaw, &CosYaw, FMath::DegreesToRadians(FRotator::DecompressAxisFromShort(Yaw)));
+        const float Size = Magnitude.GetFloat();
+        Acceleration = FVector_NetQuantize10(CosYaw * Size, SinYaw * Size, 0.f);
+    }
+}
+
+FStrafeNetworkMoveDataContainer::FStrafeNetworkMoveDataContainer()
+{
+    NewMoveData = &StrafeMoveData[0];
+    PendingMoveData = &StrafeMoveData[1];
+    OldMoveData = &StrafeMoveData[2];
+}
+
+#pragma endregion FStrafeNetworkMoveData
+
 
 UStrafeMovementComponent::UStrafeMovementComponent(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -97,12 +232,217 @@ UStrafeMovementComponent::UStrafeMovementComponent(const FObjectInitializer& Obj
     bAirAccelerationAllowsExceedingMaxWishSpeed = true;
     bEnableQuakeStepLogic = true; // Default to enabled
     QuakeStepHeight = 18.f;      // Default Q3 step height
+
+    SetNetworkMoveDataContainer(StrafeMoveDataContainer);
+    MoveCombineAngleToleranceDegrees = 2.f;
+    MoveCombineMaxVelocityError = 0.5f;
+    MaxServerMovesPerSecond = 90.f;
+
+    bUseFixedTimestep = false;
+    FixedTimestepHz = 125.f;
+    MaxFixedStepsPerFrame = 8;
+    bInterpolateFixedSteps = true;
+    FixedStepAccumulator = 0.f;
+    FixedStepPreviousLocation = FVector::ZeroVector;
+    FixedStepCurrentLocation = FVector::ZeroVector;
+    bFixedStepVisualApplied = false;
+    bServerWasFallingLastMove = false;
+
+    StepUpWallNormalZ = 0.08f;
+    StepUpQueryParamsOwner = nullptr;
+    KnownStepHits = 0;
+
+    bUseStrafeProxySmoothing = true;
+    ProxySmoothedNetUpdateFrequency = 0.f;
+    ProxyHopSpeedRatio = 1.05f;
+    ProxyMaxExtrapolationTime = 0.25f;
+    ProxyCorrectionSpeedWindow = 0.15f;
+    LastProxyUpdateTime = 0.0;
+
+    bRecordTelemetry = false;
+    TelemetryFormat = EStrafeTelemetryFormat::Binary;
+
+    LastPhysicsStepDeltaTime = 0.f;
+    CachedTelemetryFrame = MAX_uint64;
+
+    bEnableFloorCache = true;
+    FloorCacheMaxDistance = 16.f;
+    FloorCacheHeightTolerance = 0.5f;
+    FloorCacheMaxReuses = 15;
+    FloorCacheAnchorLocation = FVector::ZeroVector;
+    bFloorCacheValid = false;
+    FloorCacheReuseCount = 0;
+    FloorCacheHits = 0;
+    FloorCacheSweeps = 0;
+
+    bAllowBatchedMovement = true;
+    bHasBatchedVelocity = false;
+    BatchedFrameCounter = 0;
+    BatchedDeltaTime = 0.f;
+    BatchedMovementMode = MOVE_None;
+    bBatchedJustLanded = false;
+    BatchedInputVelocity = FVector::ZeroVector;
+    BatchedWishDirection = FVector::ZeroVector;
+    BatchedVelocity = FVector::ZeroVector;
 }
 
 void UStrafeMovementComponent::InitializeComponent()
 {
     Super::InitializeComponent();
 }
+
+void UStrafeMovementComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Only the server simulates bots; clients never run their movement.
+    if (bAllowBatchedMovement && GetOwnerRole() == ROLE_Authority)
+    {
+        if (UStrafeMovementBatchSubsystem* BatchSubsystem = GetWorld()->GetSubsystem<UStrafeMovementBatchSubsystem>())
+        {
+            BatchSubsystem->RegisterComponent(this);
+        }
+    }
+
+    if (bUseStrafeProxySmoothing && ProxySmoothedNetUpdateFrequency > 0.f && GetOwnerRole() == ROLE_Authority)
+    {
+        GetOwner()->SetNetUpdateFrequency(ProxySmoothedNetUpdateFrequency);
+    }
+
+    if (bRecordTelemetry)
+    {
+        StartTelemetryRecording();
+    }
+}
+
+bool UStrafeMovementComponent::IsStrafeSmoothedProxy() const
+{
+    return bUseStrafeProxySmoothing && CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy;
+}
+
+void UStrafeMovementComponent::ForceProxyUpdate()
+{
+    if (bUseStrafeProxySmoothing && CharacterOwner && CharacterOwner->HasAuthority() && !IsNetMode(NM_Standalone))
+    {
+        CharacterOwner->ForceNetUpdate();
+    }
+}
+
+void UStrafeMovementComponent::SimulateMovement(float DeltaTime)
+{
+    // Past the extrapolation window, hold position until the next update rather than run further off.
+    if (IsStrafeSmoothedProxy() && !bNetworkUpdateReceived && ProxyMaxExtrapolationTime > 0.f
+        && GetWorld()->GetTimeSeconds() - LastProxyUpdateTime > ProxyMaxExtrapolationTime)
+    {
+        return;
+    }
+
+    Super::SimulateMovement(DeltaTime);
+}
+
+void UStrafeMovementComponent::SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation)
+{
+    if (!IsStrafeSmoothedProxy())
+    {
+        Super::SmoothCorrection(OldLocation, OldRotation, NewLocation, NewRotation);
+        return;
+    }
+
+    LastProxyUpdateTime = GetWorld()->GetTimeSeconds();
+
+    // The engine snaps corrections beyond fixed distances (256 / 384 uu). At 1000+ uu/s and a low update rate
+    // ordinary errors get that large, so scale the thresholds with speed and blend them like small ones.
+    const float SavedMaxSmoothDistance = NetworkMaxSmoothUpdateDistance;
+    const float SavedNoSmoothDistance = NetworkNoSmoothUpdateDistance;
+    const float SpeedWindow = Velocity.Size() * ProxyCorrectionSpeedWindow;
+    NetworkMaxSmoothUpdateDistance = FMath::Max(SavedMaxSmoothDistance, SpeedWindow);
+    NetworkNoSmoothUpdateDistance = FMath::Max(SavedNoSmoothDistance, SpeedWindow * 1.5f);
+
+    Super::SmoothCorrection(OldLocation, OldRotation, NewLocation, NewRotation);
+
+    NetworkMaxSmoothUpdateDistance = SavedMaxSmoothDistance;
+    NetworkNoSmoothUpdateDistance = SavedNoSmoothDistance;
+}
+
+void UStrafeMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    StopTelemetryRecording();
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UStrafeMovementBatchSubsystem* BatchSubsystem = World->GetSubsystem<UStrafeMovementBatchSubsystem>())
+        {
+            BatchSubsystem->UnregisterComponent(this);
+        }
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+bool UStrafeMovementComponent::GatherBatchInput(float DeltaTime, FVector& OutWishDirection, float& OutWishSpeed, bool& bOutOnGround)
+{
+    bHasBatchedVelocity = false;
+
+    if (!bAllowBatchedMovement || !HasValidData() || !IsActive() || !CharacterOwner->Controller || CharacterOwner->IsPlayerControlled())
+    {
+        return false;
+    }
+    if ((MovementMode != MOVE_Walking && MovementMode != MOVE_Falling) || HasAnimRootMotion() || CurrentRootMotion.HasActiveRootMotionSources())
+    {
+        return false;
+    }
+    // Mirrors the simulation step limit; substepped frames go through the scalar path.
+    if (DeltaTime < MIN_TICK_TIME || DeltaTime > MaxSimulationTimeStep)
+    {
+        return false;
+    }
+
+    // The Acceleration PhysWalking/PhysFalling will see is the pending input constrained to the horizontal plane.
+    FVector WishDirection = CharacterOwner->GetPendingMovementInputVector();
+    WishDirection.Z = 0.f;
+    WishDirection = StrafePhysics::QuantizePlanarDirection(WishDirection).GetSafeNormal();
+
+    bOutOnGround = MovementMode == MOVE_Walking;
+    OutWishDirection = WishDirection;
+    OutWishSpeed = (bOutOnGround && IsCrouching()) ? GetMaxSpeed() : MaxWishSpeed;
+
+    BatchedFrameCounter = GFrameCounter;
+    BatchedDeltaTime = DeltaTime;
+    BatchedMovementMode = MovementMode;
+    bBatchedJustLanded = bJustLandedFrame;
+    BatchedInputVelocity = Velocity;
+    BatchedWishDirection = WishDirection;
+    return true;
+}
+
+void UStrafeMovementComponent::ReceiveBatchedVelocity(const FVector& InVelocity)
+{
+    BatchedVelocity = InVelocity;
+    bHasBatchedVelocity = true;
+}
+
+bool UStrafeMovementComponent::ConsumeBatchedVelocity(float DeltaTime, const FVector& WishDirection)
+{
+    if (!bHasBatchedVelocity)
+    {
+        return false;
+    }
+    bHasBatchedVelocity = false;
+
+    // Anything that touched the mover between the batch and now (impulses, mode changes, substeps, new input)
+    // invalidates the result.
+    if (BatchedFrameCounter != GFrameCounter
+        || BatchedDeltaTime != DeltaTime
+        || BatchedMovementMode != MovementMode
+        || bBatchedJustLanded != bJustLandedFrame
+        || BatchedInputVelocity != Velocity
+        || !BatchedWishDirection.Equals(WishDirection, KINDA_SMALL_NUMBER))
+    {
+        return false;
+    }
+
+    Velocity = BatchedVelocity;
+    return true;
+}
 // GetMaxAcceleration, GetMaxBrakingDeceleration, CalcVelocity (same as before) ...
 
 float UStrafeMovementComponent::GetMaxAcceleration() const
@@ -139,6 +479,7 @@ void UStrafeMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
     {
         return;
     }
+    LastPhysicsStepDeltaTime = deltaTime;
 
     if (!CharacterOwner || (!CharacterOwner->Controller && !bRunPhysicsWithNoController && !HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity() && (CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy)))
     {
@@ -155,6 +496,17 @@ void UStrafeMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
         }
     }
 
+    // Simulated proxies have no input. A landing above the speed cap is a strafe-jumper who will hop again
+    // this frame, so predict the hop instead of braking on the ground until the server says otherwise.
+    const bool bStrafeProxy = IsStrafeSmoothedProxy();
+    if (bStrafeProxy && bJustLandedFrame && Velocity.SizeSquared2D() > FMath::Square(MaxWishSpeed * ProxyHopSpeedRatio))
+    {
+        bJustLandedFrame = false;
+        Velocity.Z = StrafeJumpImpulse;
+        SetMovementMode(MOVE_Falling);
+        return;
+    }
+
     const FVector PreFrameLocation = UpdatedComponent->GetComponentLocation();
     const FVector PreFrameVelocityForStep = Velocity;
 
@@ -167,8 +519,12 @@ void UStrafeMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
     FVector WishDirection = Acceleration.GetSafeNormal();
     float WishSpeed = CurrentWishSpeed;
 
-    ApplyStrafeFriction(deltaTime);
-    ApplyStrafeAcceleration(WishDirection, WishSpeed, GroundAccelerationFactor, deltaTime);
+    // Proxies coast on the replicated velocity; friction with a made-up wish direction only adds error.
+    if (!bStrafeProxy && !ConsumeBatchedVelocity(deltaTime, WishDirection))
+    {
+        ApplyStrafeFriction(deltaTime);
+        ApplyStrafeAcceleration(WishDirection, WishSpeed, GroundAccelerationFactor, deltaTime);
+    }
 
     Iterations++;
     bJustTeleported = false;
@@ -194,7 +550,7 @@ void UStrafeMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
         }
     }
 
-    FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+    UpdateWalkingFloor();
 
     if (!CurrentFloor.IsWalkableFloor())
     {
@@ -211,6 +567,64 @@ void UStrafeMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
     }
 }
 
+void UStrafeMovementComponent::UpdateWalkingFloor()
+{
+    const FVector CapsuleLocation = UpdatedComponent->GetComponentLocation();
+
+    if (CanReuseFloor(CapsuleLocation))
+    {
+        // The floor is a horizontal plane, so the hit moves with us and FloorDist is unchanged.
+        const FVector Shift(CapsuleLocation.X - FloorCacheAnchorLocation.X, CapsuleLocation.Y - FloorCacheAnchorLocation.Y, 0.f);
+        FHitResult& FloorHit = CurrentFloor.HitResult;
+        FloorHit.TraceStart += Shift;
+        FloorHit.TraceEnd += Shift;
+        FloorHit.Location += Shift;
+        FloorHit.ImpactPoint += Shift;
+        FloorCacheAnchorLocation = CapsuleLocation;
+        ++FloorCacheReuseCount;
+        ++FloorCacheHits;
+        return;
+    }
+
+    FindFloor(CapsuleLocation, CurrentFloor, false);
+    FloorCacheAnchorLocation = CapsuleLocation;
+    bFloorCacheValid = true;
+    FloorCacheReuseCount = 0;
+    ++FloorCacheSweeps;
+}
+
+bool UStrafeMovementComponent::CanReuseFloor(const FVector& CapsuleLocation) const
+{
+    if (!bEnableFloorCache || !bFloorCacheValid || bJustTeleported || bForceNextFloorCheck || bAlwaysCheckFloor
+        || FloorCacheReuseCount >= FloorCacheMaxReuses)
+    {
+        return false;
+    }
+
+    if (!CurrentFloor.IsWalkableFloor() || CurrentFloor.bLineTrace || CurrentFloor.HitResult.ImpactNormal.Z < 1.f - KINDA_SMALL_NUMBER)
+    {
+        return false;
+    }
+
+    // Anything that moves, or could stop blocking us, has to be swept.
+    const UPrimitiveComponent* Floor = CurrentFloor.HitResult.GetComponent();
+    if (!Floor || Floor->GetMobility() != EComponentMobility::Static || !Floor->IsQueryCollisionEnabled()
+        || Floor->GetCollisionResponseToChannel(UpdatedComponent->GetCollisionObjectType()) != ECR_Block)
+    {
+        return false;
+    }
+
+    if (FMath::Abs(CapsuleLocation.Z - FloorCacheAnchorLocation.Z) > FloorCacheHeightTolerance
+        || FVector::DistSquared2D(CapsuleLocation, FloorCacheAnchorLocation) > FMath::Square(FloorCacheMaxDistance))
+    {
+        return false;
+    }
+
+    const FBox FloorBounds = Floor->Bounds.GetBox();
+    return CapsuleLocation.X >= FloorBounds.Min.X && CapsuleLocation.X <= FloorBounds.Max.X
+        && CapsuleLocation.Y >= FloorBounds.Min.Y && CapsuleLocation.Y <= FloorBounds.Max.Y;
+}
+
 
 void UStrafeMovementComponent::PhysFalling(float deltaTime, int32 Iterations)
 {
@@ -218,13 +632,10 @@ void UStrafeMovementComponent::PhysFalling(float deltaTime, int32 Iterations)
     {
         return;
     }
+    LastPhysicsStepDeltaTime = deltaTime;
 
     FVector PreMoveVelocity = Velocity;
 
-    Velocity.Z += GetGravityZ() * GravityScale * deltaTime;
-
-    const float ZVelocityAfterGravity = Velocity.Z;
-
     FVector WishDirection = Acceleration.GetSafeNormal();
     CurrentWishSpeed = MaxWishSpeed; // You might want to use GetMaxSpeed() if crouch/etc. affects air speed wish.
 
@@ -235,11 +646,19 @@ void UStrafeMovementComponent::PhysFalling(float deltaTime, int32 Iterations)
         AirWishDir = FVector::ZeroVector;
     }
 
-    if (!AirWishDir.IsNearlyZero())
+    if (!ConsumeBatchedVelocity(deltaTime, AirWishDir))
     {
-        // ApplyStrafeAcceleration modifies Velocity.X and Velocity.Y based on AirWishDir and AirAccelerationFactor
-        ApplyStrafeAcceleration(AirWishDir, CurrentWishSpeed, AirAccelerationFactor, deltaTime);
+        Velocity.Z += GetGravityZ() * GravityScale * deltaTime;
+
+        if (!AirWishDir.IsNearlyZero())
+        {
+            // ApplyStrafeAcceleration modifies Velocity.X and Velocity.Y based on AirWishDir and AirAccelerationFactor
+            ApplyStrafeAcceleration(AirWishDir, CurrentWishSpeed, AirAccelerationFactor, deltaTime);
+        }
     }
+
+    // Air acceleration never touches Z, so this is the velocity after this frame's gravity.
+    const float ZVelocityAfterGravity = Velocity.Z;
     // At this point, Velocity.X and Velocity.Y are from air acceleration,
     // and Velocity.Z is ZVelocityAfterGravity (original Z + this frame's gravity).
 
@@ -305,93 +724,34 @@ void UStrafeMovementComponent::ApplyStrafeFriction(float DeltaTime)
         return;
     }
 
-    float Speed = Velocity.Size2D();
-    if (Speed < 1.0f)
-    {
-        Velocity.X = 0.f;
-        Velocity.Y = 0.f;
-        return;
-    }
-
-    float Drop = 0.f;
-    float Control = Speed < GroundStopSpeed ? GroundStopSpeed : Speed;
-    Drop += Control * GroundFrictionFactor * DeltaTime;
-
-    float NewSpeed = Speed - Drop;
-    if (NewSpeed < 0.f)
-    {
-        NewSpeed = 0.f;
-    }
-
-    if (Speed > 0.f)
-    {
-        NewSpeed /= Speed;
-        Velocity.X *= NewSpeed;
-        Velocity.Y *= NewSpeed;
-    }
-    else
-    {
-        Velocity.X = 0.f;
-        Velocity.Y = 0.f;
-    }
+    StrafePhysics::ApplyFriction(Velocity, GroundStopSpeed, GroundFrictionFactor, DeltaTime);
 }
 
 
 
 void UStrafeMovementComponent::ApplyStrafeAcceleration(const FVector& WishDirection, float WishSpeed, float AccelerationParam, float DeltaTime)
 {
-    if (WishDirection.IsNearlyZero() || WishSpeed <= 0.f || AccelerationParam <= 0.f || DeltaTime <= 0.f)
-    {
-        return;
-    }
-
-    FVector CurrentVelocityForAccel = Velocity;
-    if (MovementMode == MOVE_Falling)
-    {
-        // Only consider XY plane for air acceleration calculations against WishSpeed limit
-        CurrentVelocityForAccel = FVector(Velocity.X, Velocity.Y, 0.f);
-    }
-
-    float currentSpeedAlongWishDir = FVector::DotProduct(CurrentVelocityForAccel, WishDirection);
-    float addSpeed = WishSpeed - currentSpeedAlongWishDir;
-
-    // This is the fundamental Quake rule: only accelerate if the speed component
-    // in the desired direction is less than the wish speed.
-    if (addSpeed <= 0.f)
-    {
-        // If bAirAccelerationAllowsExceedingMaxWishSpeed was meant for something else (like ignoring
-        // the clamping of accelAmount to addSpeed), that would be a different logic.
-        // For true Quake feel, this return is essential.
-        return;
-    }
-
-    // Calculate ideal acceleration amount for this frame
-    // Q3: accelspeed = accel_param * pml.frametime * wishspeed_config;
-    float accelAmount = AccelerationParam * DeltaTime * WishSpeed;
+    // Measured in the XY plane in every mode, which is also what FStrafeMovementBatch computes.
+    StrafePhysics::ApplyAcceleration(Velocity, WishDirection, WishSpeed, AccelerationParam, DeltaTime);
 
-    // Clamp accelAmount to not exceed addSpeed in one frame.
-    // This prevents overshooting the 'wishspeed' along 'wishdir' in a single physics tick.
-    if (accelAmount > addSpeed)
+    // Ground speed clamping (GetMaxSpeed() considers crouch etc.), skipped on the landing frame for bunny hops.
+    if (IsMovingOnGround() && !bJustLandedFrame)
     {
-        accelAmount = addSpeed;
+        StrafePhysics::ClampHorizontalSpeed(Velocity, GetMaxSpeed());
     }
+}
 
-    FVector addedVelocity = accelAmount * WishDirection;
-
-    Velocity.X += addedVelocity.X;
-    Velocity.Y += addedVelocity.Y;
-    // Z velocity is handled by gravity/jumping/etc. elsewhere
-
-    // Ground speed clamping should remain as is, if IsMovingOnGround()
-    if (IsMovingOnGround() && !bJustLandedFrame) {
-        float MaxGroundSpeed = GetMaxSpeed(); // GetMaxSpeed() considers crouch etc.
-        FVector XYVel = FVector(Velocity.X, Velocity.Y, 0);
-        if (XYVel.SizeSquared() > FMath::Square(MaxGroundSpeed)) {
-            XYVel = XYVel.GetSafeNormal() * MaxGroundSpeed;
-            Velocity.X = XYVel.X;
-            Velocity.Y = XYVel.Y;
-        }
-    }
+FStrafeMoveParams UStrafeMovementComponent::GetStrafeMoveParams() const
+{
+    FStrafeMoveParams Params;
+    Params.MaxWishSpeed = MaxWishSpeed;
+    Params.GroundFrictionFactor = GroundFrictionFactor;
+    Params.GroundStopSpeed = GroundStopSpeed;
+    Params.GroundAccelerationFactor = GroundAccelerationFactor;
+    Params.AirAccelerationFactor = AirAccelerationFactor;
+    Params.MaxGroundSpeed = GetMaxSpeed();
+    Params.GravityZ = GetGravityZ() * GravityScale;
+    return Params;
 }
 
 
@@ -407,6 +767,7 @@ bool UStrafeMovementComponent::DoJump(bool bReplayingMoves)
         SetMovementMode(MOVE_Falling);
         bStrafeJumpHeld = true;
         CharacterOwner->OnJumped();
+        ForceProxyUpdate();
         return true;
     }
     return false;
@@ -417,6 +778,15 @@ void UStrafeMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovem
 {
     Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
 
+    // Landing, jumping and mode switches all establish a new floor; never carry the old one over.
+    bFloorCacheValid = false;
+
+    // Landings and launches break the ballistic arc proxies are extrapolating.
+    if (MovementMode != PreviousMovementMode)
+    {
+        ForceProxyUpdate();
+    }
+
     if (!HasValidData())
     {
         return;
@@ -462,15 +832,198 @@ FNetworkPredictionData_Client* UStrafeMovementComponent::GetPredictionData_Clien
     return ClientPredictionData;
 }
 
+float UStrafeMovementComponent::GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const
+{
+    const float EngineDeltaTime = Super::GetClientNetSendDeltaTime(PC, ClientData, NewMove);
+    if (MaxServerMovesPerSecond <= 0.f)
+    {
+        return EngineDeltaTime;
+    }
+    // Moves held back by the budget are combined where CanCombineWith allows, or sent together as pending/new pairs.
+    return FMath::Max(EngineDeltaTime, 1.f / MaxServerMovesPerSecond);
+}
+
 void UStrafeMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
 {
     Super::UpdateFromCompressedFlags(Flags);
-    if (CharacterOwner)
+    // Moves that carry FStrafeNetworkMoveData set bStrafeJumpHeld in MoveAutonomous.
+    if (CharacterOwner && !GetCurrentNetworkMoveData())
     {
         bStrafeJumpHeld = CharacterOwner->bPressedJump;
     }
 }
 
+void UStrafeMovementComponent::ControlledCharacterMove(const FVector& InputVector, float DeltaSeconds)
+{
+    if (!bUseFixedTimestep || FixedTimestepHz <= 0.f || !UpdatedComponent)
+    {
+        Super::ControlledCharacterMove(InputVector, DeltaSeconds);
+        return;
+    }
+
+    RestoreFixedStepLocation();
+
+    // Each step is a complete move (jump check, acceleration, PerformMovement or ServerMove), so the server
+    // simulates exactly the same fixed steps.
+    const float StepTime = 1.f / FixedTimestepHz;
+    FixedStepAccumulator += DeltaSeconds;
+
+    int32 NumSteps = 0;
+    while (FixedStepAccumulator >= StepTime && NumSteps < MaxFixedStepsPerFrame)
+    {
+        FixedStepPreviousLocation = UpdatedComponent->GetComponentLocation();
+        Super::ControlledCharacterMove(InputVector, StepTime);
+        FixedStepCurrentLocation = UpdatedComponent->GetComponentLocation();
+        FixedStepAccumulator -= StepTime;
+        ++NumSteps;
+    }
+
+    if (NumSteps == MaxFixedStepsPerFrame && FixedStepAccumulator >= StepTime)
+    {
+        FixedStepAccumulator = FMath::Fmod(FixedStepAccumulator, StepTime);
+    }
+
+    ApplyFixedStepInterpolation(FixedStepAccumulator / StepTime);
+}
+
+void UStrafeMovementComponent::RestoreFixedStepLocation()
+{
+    const FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
+    if (bFixedStepVisualApplied)
+    {
+        bFixedStepVisualApplied = false;
+        if (USkeletalMeshComponent* Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr)
+        {
+            Mesh->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset(), false, nullptr, ETeleportType::TeleportPhysics);
+        }
+    }
+
+    if (!CurrentLocation.Equals(FixedStepCurrentLocation, KINDA_SMALL_NUMBER))
+    {
+        // A server correction, teleport or base movement moved us since the last step; that is the new truth.
+        FixedStepPreviousLocation = FixedStepCurrentLocation = CurrentLocation;
+    }
+}
+
+void UStrafeMovementComponent::ApplyFixedStepInterpolation(float Alpha)
+{
+    USkeletalMeshComponent* Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr;
+    if (!bInterpolateFixedSteps || !Mesh || FixedStepPreviousLocation.Equals(FixedStepCurrentLocation))
+    {
+        return;
+    }
+
+    // Don't smear teleports across a step.
+    const float MaxStepDistance = FMath::Max(Velocity.Size(), MaxWishSpeed) * 2.f / FixedTimestepHz;
+    if (FVector::DistSquared(FixedStepPreviousLocation, FixedStepCurrentLocation) > FMath::Square(MaxStepDistance))
+    {
+        return;
+    }
+
+    // Same as the engine's proxy smoothing: the capsule stays at the simulated location and only the mesh is
+    // offset, so collision, overlaps and anything sampling the capsule this frame see the real position.
+    const FVector VisualOffset = FMath::Lerp(FixedStepPreviousLocation, FixedStepCurrentLocation, FMath::Clamp(Alpha, 0.f, 1.f)) - FixedStepCurrentLocation;
+    const FVector NewRelTranslation = UpdatedComponent->GetComponentTransform().InverseTransformVectorNoScale(VisualOffset) + CharacterOwner->GetBaseTranslationOffset();
+    Mesh->SetRelativeLocation(NewRelTranslation, false, nullptr, ETeleportType::TeleportPhysics);
+    bFixedStepVisualApplied = true;
+}
+
+void UStrafeMovementComponent::OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity)
+{
+    Super::OnMovementUpdated(DeltaSeconds, OldLocation, OldVelocity);
+
+    // Correction replays re-simulate moves that were already recorded.
+    if (TelemetryRecorder && !bClientUpdating)
+    {
+        PushTelemetryRecord(DeltaSeconds);
+    }
+}
+
+void UStrafeMovementComponent::StartTelemetryRecording()
+{
+    if (!TelemetryRecorder)
+    {
+        TelemetryRecorder = FStrafeTelemetryRecorder::Acquire(TelemetryFormat);
+    }
+}
+
+void UStrafeMovementComponent::StopTelemetryRecording()
+{
+    // The last component to let go closes the file.
+    TelemetryRecorder.Reset();
+}
+
+void UStrafeMovementComponent::PushTelemetryRecord(float DeltaSeconds)
+{
+    if (!CharacterOwner)
+    {
+        return;
+    }
+
+    FStrafeTelemetryRecord Record;
+    FMemory::Memzero(Record);
+    Record.WorldTime = GetWorld()->GetTimeSeconds();
+    Record.DeltaTime = DeltaSeconds;
+    Record.FrameNumber = static_cast<uint32>(GFrameCounter);
+    Record.Location = FVector3f(UpdatedComponent->GetComponentLocation());
+    Record.Velocity = FVector3f(Velocity);
+    Record.MovementMode = MovementMode;
+
+    const APlayerState* PlayerState = CharacterOwner->GetPlayerState();
+    Record.MoverId = PlayerState ? static_cast<uint32>(PlayerState->GetPlayerId()) : CharacterOwner->GetUniqueID();
+
+    const bool bAuthority = CharacterOwner->HasAuthority();
+    const bool bLocallyControlled = CharacterOwner->IsLocallyControlled();
+    if (!bAuthority && HasPredictionData_Client())
+    {
+        Record.MoveTimeStamp = GetPredictionData_Client_Character()->CurrentTimeStamp;
+    }
+    else if (bAuthority && !bLocallyControlled && HasPredictionData_Server())
+    {
+        Record.MoveTimeStamp = GetPredictionData_Server_Character()->CurrentClientTimeStamp;
+    }
+
+    const FVector2D Wish = FVector2D(Acceleration.X, Acceleration.Y).GetSafeNormal();
+    Record.WishDirection = FVector2f(Wish);
+    const FVector2D Velocity2D(Velocity.X, Velocity.Y);
+    const float Speed2D = Velocity2D.Size();
+    if (Speed2D > KINDA_SMALL_NUMBER && !Wish.IsNearlyZero())
+    {
+        Record.StrafeDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector2D::DotProduct(Velocity2D / Speed2D, Wish), -1.f, 1.f)));
+    }
+
+    Record.Flags = static_cast<uint8>((IsMovingOnGround() ? EStrafeTelemetryFlags::OnGround : 0)
+        | (bJustLandedFrame ? EStrafeTelemetryFlags::JustLanded : 0)
+        | (bAuthority ? EStrafeTelemetryFlags::Authority : 0)
+        | (bLocallyControlled ? EStrafeTelemetryFlags::LocallyControlled : 0));
+
+    TelemetryRecorder->Push(Record);
+}
+
+FVector UStrafeMovementComponent::ConstrainInputAcceleration(const FVector& InputAcceleration) const
+{
+    // Quantize to what FStrafeNetworkMoveData can send, so client and server simulate the same wish direction.
+    return StrafePhysics::QuantizePlanarDirection(Super::ConstrainInputAcceleration(InputAcceleration));
+}
+
+void UStrafeMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+    if (const FStrafeNetworkMoveData* MoveData = static_cast<const FStrafeNetworkMoveData*>(GetCurrentNetworkMoveData()))
+    {
+        bStrafeJumpHeld = MoveData->bStrafeJumpHeld;
+        // The landing frame skips friction, so only honour the client's claim if we were airborne ourselves
+        // at the end of the previous move; otherwise it could be held forever.
+        if (MoveData->bJustLandedFrame != bJustLandedFrame)
+        {
+            bJustLandedFrame = MoveData->bJustLandedFrame && bServerWasFallingLastMove;
+        }
+    }
+
+    Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+
+    bServerWasFallingLastMove = IsFalling();
+}
+
 
 void UStrafeMovementComponent::SetMovementPreset(EStrafeMovementPreset NewPreset)
 {
@@ -531,14 +1084,7 @@ void UStrafeMovementComponent::ApplyStrafeImpulse(const FVector& Impulse, bool b
 
 FVector UStrafeMovementComponent::ClipVelocity(const FVector& InVelocity, const FVector& ImpactNormal, float Overbounce) const
 {
-    float Backoff = FVector::DotProduct(InVelocity, ImpactNormal);
-
-    if (Backoff < 0.f)
-    {
-        FVector AdjustedNormal = ImpactNormal * Backoff * Overbounce;
-        return InVelocity - AdjustedNormal;
-    }
-    return InVelocity;
+    return StrafePhysics::ClipVelocity(InVelocity, ImpactNormal, Overbounce);
 }
 
 bool UStrafeMovementComponent::IsAgainstBlockingWall(const FVector& ImpactNormal) const
@@ -565,6 +1111,17 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
     const FQuat CurrentRotation = UpdatedComponent->GetComponentQuat();
     UCapsuleComponent* Capsule = CharacterOwner->GetCapsuleComponent();
 
+    // 0. Cheap rejections and the known-step shortcut, before any sweep.
+    const float ImpactHeight = InitialBlockHit.ImpactPoint.Z - (LocationAtImpact.Z - Capsule->GetScaledCapsuleHalfHeight());
+    if (IsUnsteppableWall(InitialBlockHit, ImpactHeight))
+    {
+        return false;
+    }
+    if (TryKnownStepUp(InitialBlockHit, ImpactHeight, PreFrameVelocity, DeltaTime))
+    {
+        return true;
+    }
+
     // 1. Can we even attempt a step? (Simplified Q3 check)
     // Q3 checks if velocity[z] > 0 AND (ground is far OR ground is steep) then returns.
     // This prevents trying to step up if already in the upward arc of a jump onto a high ledge.
@@ -586,9 +1143,6 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
     FVector TestUpStart = PreFrameLocation;
     FVector TestUpEnd = PreFrameLocation + FVector(0.f, 0.f, QuakeStepHeight);
     FHitResult UpTraceHit;
-    FName TraceTag("StrafeStepUp_UpTrace");
-    FCollisionQueryParams CapsuleParams(TraceTag, false, CharacterOwner); // Standard capsule trace
-
     bool bHitUp = GetWorld()->SweepSingleByChannel(
         UpTraceHit,
         TestUpStart,
@@ -596,7 +1150,7 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
         CurrentRotation,
         UpdatedComponent->GetCollisionObjectType(), // ECC_Pawn usually
         Capsule->GetCollisionShape(),
-        CapsuleParams
+        GetStepUpQueryParams()
     );
 
     float ActualVerticalStepAchieved = 0.f;
@@ -643,9 +1197,6 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
     // Push down by the amount we stepped up, plus a small extra to ensure contact.
     FVector PushDownEnd = LocationAfterSecondSlide - FVector(0.f, 0.f, ActualVerticalStepAchieved + 2.0f);
     FHitResult PushDownHit;
-    FName PushDownTraceTag("StrafeStepUp_PushDown");
-    FCollisionQueryParams PushDownParams(PushDownTraceTag, false, CharacterOwner);
-
     bool bHitDown = GetWorld()->SweepSingleByChannel(
         PushDownHit,
         PushDownStart,
@@ -653,7 +1204,7 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
         CurrentRotation,
         UpdatedComponent->GetCollisionObjectType(),
         Capsule->GetCollisionShape(),
-        PushDownParams
+        GetStepUpQueryParams()
     );
 
     if (bHitDown && PushDownHit.IsValidBlockingHit()) // Must hit something to land on
@@ -661,6 +1212,10 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
         // Successfully landed on something after stepping up and moving.
         UpdatedComponent->SetWorldLocation(PushDownHit.ImpactPoint, false, nullptr, ETeleportType::TeleportPhysics);
         FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+        FloorCacheAnchorLocation = UpdatedComponent->GetComponentLocation();
+        bFloorCacheValid = true;
+        FloorCacheReuseCount = 0;
+        ++FloorCacheSweeps;
 
         if (CurrentFloor.IsWalkableFloor())
         {
@@ -671,6 +1226,7 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
             Velocity = FVector::VectorPlaneProject(Velocity, PushDownHit.ImpactNormal);
             Velocity.Z = FMath::Min(0.f, Velocity.Z); // Don't have positive Z velocity if on ground.
             SetMovementMode(MOVE_Walking); // Ensure walking mode.
+            RememberKnownStep(InitialBlockHit.GetComponent());
             // UE's StepUp also adjusts Z in a similar fashion after a successful step.
             // StartNewPhysics(DeltaTime, Iterations); // Might be needed if mode changes significantly
             return true;
@@ -693,35 +1249,152 @@ bool UStrafeMovementComponent::TryStrafeStepUp(const FHitResult& InitialBlockHit
     return false;
 }
 
+const FCollisionQueryParams& UStrafeMovementComponent::GetStepUpQueryParams()
+{
+    if (StepUpQueryParamsOwner != CharacterOwner)
+    {
+        StepUpQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(StrafeStepUp), false, CharacterOwner);
+        StepUpQueryParamsOwner = CharacterOwner;
+    }
+    return StepUpQueryParams;
+}
 
+bool UStrafeMovementComponent::IsUnsteppableWall(const FHitResult& BlockHit, float ImpactHeight) const
+{
+    // A near-horizontal normal means we touched a face, not an edge. If that contact is already above
+    // the step height, lifting the capsule by the step height can't clear it.
+    return FMath::Abs(BlockHit.ImpactNormal.Z) < StepUpWallNormalZ && ImpactHeight > QuakeStepHeight;
+}
 
+bool UStrafeMovementComponent::TryKnownStepUp(const FHitResult& BlockHit, float ImpactHeight, const FVector& PreFrameVelocity, float DeltaTime)
+{
+    // Only edge contacts on geometry we have already climbed: the impact point is then the top of the step.
+    const UPrimitiveComponent* StepComponent = BlockHit.GetComponent();
+    if (!StepComponent || StepComponent->GetMobility() != EComponentMobility::Static
+        || BlockHit.ImpactNormal.Z <= KINDA_SMALL_NUMBER || ImpactHeight <= 0.f || ImpactHeight > QuakeStepHeight
+        || !KnownStepComponents.Contains(StepComponent))
+    {
+        return false;
+    }
 
+    const FVector LocationAtImpact = UpdatedComponent->GetComponentLocation();
+    const FQuat CurrentRotation = UpdatedComponent->GetComponentQuat();
+    UpdatedComponent->SetWorldLocation(LocationAtImpact + FVector(0.f, 0.f, ImpactHeight + MIN_FLOOR_DIST), false, nullptr, ETeleportType::TeleportPhysics);
+
+    // The only sweep: the rest of this frame's horizontal move from on top of the step.
+    // Starting in penetration means something is above the step; let the full path sort it out.
+    FHitResult ForwardHit(1.f);
+    const FVector RemainingDelta = FVector(PreFrameVelocity.X, PreFrameVelocity.Y, 0.f) * DeltaTime * (1.f - BlockHit.Time);
+    MoveUpdatedComponent(RemainingDelta, CurrentRotation, true, &ForwardHit);
+    if (ForwardHit.bStartPenetrating)
+    {
+        UpdatedComponent->SetWorldLocation(LocationAtImpact, false, nullptr, ETeleportType::TeleportPhysics);
+        return false;
+    }
 
+    Velocity = PreFrameVelocity;
+    Velocity.Z = FMath::Min(0.f, Velocity.Z);
+    // PhysWalking's floor update sweeps for the new floor and falls if the top wasn't walkable.
+    bFloorCacheValid = false;
+    ++KnownStepHits;
+    return true;
+}
 
+void UStrafeMovementComponent::RememberKnownStep(const UPrimitiveComponent* StepComponent)
+{
+    if (!StepComponent || StepComponent->GetMobility() != EComponentMobility::Static)
+    {
+        return;
+    }
 
+    const int32 ExistingIndex = KnownStepComponents.IndexOfByKey(StepComponent);
+    if (ExistingIndex != INDEX_NONE)
+    {
+        KnownStepComponents.RemoveAt(ExistingIndex);
+    }
+    else if (KnownStepComponents.Num() >= MaxKnownSteps)
+    {
+        KnownStepComponents.RemoveAt(0);
+    }
+    KnownStepComponents.Add(StepComponent);
+}
+
+const FStrafeTelemetry& UStrafeMovementComponent::GetStrafeTelemetry() const
+{
+    if (CachedTelemetryFrame != GFrameCounter)
+    {
+        ComputeStrafeTelemetry(CachedTelemetry);
+        CachedTelemetryFrame = GFrameCounter;
+    }
+    return CachedTelemetry;
+}
 
+void UStrafeMovementComponent::ComputeStrafeTelemetry(FStrafeTelemetry& OutTelemetry) const
+{
+    OutTelemetry = FStrafeTelemetry();
+    OutTelemetry.WorldVelocity2D = FVector2D(Velocity.X, Velocity.Y);
+    OutTelemetry.Speed2D = OutTelemetry.WorldVelocity2D.Size();
+    OutTelemetry.WorldWishDirection2D = FVector2D(Acceleration.X, Acceleration.Y).GetSafeNormal();
+    OutTelemetry.SpeedCapS = MaxWishSpeed;
+    OutTelemetry.bOnGround = IsMovingOnGround();
 
+    // Before the first step there is no physics delta yet; the frame delta is the best guess.
+    const float StepTime = LastPhysicsStepDeltaTime > 0.f ? LastPhysicsStepDeltaTime : (GetWorld() ? GetWorld()->GetDeltaSeconds() : 0.f);
+    OutTelemetry.EffectiveAccelerationA = MaxWishSpeed * (IsFalling() ? AirAccelerationFactor : GroundAccelerationFactor) * StepTime;
 
+    if (CharacterOwner)
+    {
+        // Rotating by -yaw is multiplying by the conjugate of the forward vector.
+        const FVector Forward = CharacterOwner->GetActorForwardVector();
+        const FVector2D Orientation = FVector2D(Forward.X, Forward.Y).GetSafeNormal();
+        const auto ToPlayerSpace = [&Orientation](const FVector2D& V)
+        {
+            return FVector2D(V.X * Orientation.X + V.Y * Orientation.Y, V.Y * Orientation.X - V.X * Orientation.Y);
+        };
+        OutTelemetry.WorldPlayerOrientation2D = Orientation;
+        OutTelemetry.PlayerRelativeVelocity2D = ToPlayerSpace(OutTelemetry.WorldVelocity2D);
+        OutTelemetry.PlayerRelativeWishDirection2D = ToPlayerSpace(OutTelemetry.WorldWishDirection2D);
+    }
+    else
+    {
+        OutTelemetry.PlayerRelativeVelocity2D = OutTelemetry.WorldVelocity2D;
+        OutTelemetry.PlayerRelativeWishDirection2D = OutTelemetry.WorldWishDirection2D;
+    }
+
+    const float CurrentSpeed = OutTelemetry.Speed2D;
+    const float S = OutTelemetry.SpeedCapS;
+    const float A = OutTelemetry.EffectiveAccelerationA;
+    FStrafeAngleInfo& Info = OutTelemetry.AngleInfo;
+
+    if (CurrentSpeed < KINDA_SMALL_NUMBER || S < KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
 
+    if (!OutTelemetry.WorldWishDirection2D.IsNearlyZero())
+    {
+        const float DotProduct = FVector2D::DotProduct(OutTelemetry.WorldVelocity2D / CurrentSpeed, OutTelemetry.WorldWishDirection2D);
+        Info.CurrentDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(DotProduct, -1.f, 1.f)));
+    }
 
+    Info.OptimalDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp((S - A) / CurrentSpeed, -1.f, 1.f)));
+    Info.MinDeltaDegrees = S >= CurrentSpeed ? 0.f : FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(S / CurrentSpeed, -1.f, 1.f)));
+    Info.MaxGainDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(-A / (2 * CurrentSpeed), -1.f, 1.f)));
+}
 
 FVector2D UStrafeMovementComponent::GetWorldVelocity2D() const
 {
-    return FVector2D(Velocity.X, Velocity.Y);
+    return GetStrafeTelemetry().WorldVelocity2D;
 }
 
 FVector2D UStrafeMovementComponent::GetWorldPlayerOrientation2D() const
 {
-    if (CharacterOwner)
-    {
-        return FVector2D(CharacterOwner->GetActorForwardVector().X, CharacterOwner->GetActorForwardVector().Y).GetSafeNormal();
-    }
-    return FVector2D::ZeroVector;
+    return GetStrafeTelemetry().WorldPlayerOrientation2D;
 }
 
 FVector2D UStrafeMovementComponent::GetWorldWishDirection2D() const
 {
-    return FVector2D(Acceleration.X, Acceleration.Y).GetSafeNormal();
+    return GetStrafeTelemetry().WorldWishDirection2D;
 }
 
 
@@ -746,70 +1419,21 @@ FRotator UStrafeMovementComponent::GetPlayerOrientationInverseRotation() const
 
 FVector2D UStrafeMovementComponent::GetPlayerRelativeVelocity2D() const
 {
-    FVector2D WorldVel = GetWorldVelocity2D();
-    if (CharacterOwner)
-    {
-        FVector RotatedVector = GetPlayerOrientationInverseRotation().RotateVector(FVector(WorldVel.X, WorldVel.Y, 0.f));
-        return FVector2D(RotatedVector.X, RotatedVector.Y);
-    }
-    return WorldVel; // Fallback
+    return GetStrafeTelemetry().PlayerRelativeVelocity2D;
 }
 
 FVector2D UStrafeMovementComponent::GetPlayerRelativeWishDirection2D() const
 {
-    FVector2D WorldWish = GetWorldWishDirection2D();
-    if (CharacterOwner)
-    {
-        FVector RotatedVector = GetPlayerOrientationInverseRotation().RotateVector(FVector(WorldWish.X, WorldWish.Y, 0.f));
-        return FVector2D(RotatedVector.X, RotatedVector.Y);
-    }
-    return WorldWish; // Fallback
+    return GetStrafeTelemetry().PlayerRelativeWishDirection2D;
 }
 
 float UStrafeMovementComponent::GetEffectiveAccelerationA() const
 {
-    if (!GetWorld()) return 0.f;
-    float DeltaTime = GetWorld()->GetDeltaSeconds(); // Current frame's delta time
-    float AccelParam = IsMovingOnGround() ? GroundAccelerationFactor : AirAccelerationFactor;
-    // This matches the article's a = sT * pml.frametime * wishspeed_config (if frametime = T and wishspeed_config = MaxWishSpeed)
-    // And a = accel_param * pml.frametime * wishspeed_config
-    // The article's 'a' = 2.56 is derived from s (MaxWishSpeed=320) * T (frametime, e.g., 1/125s)
-    // So, for the formulas, 'a' can be MaxWishSpeed * (relevant_pm_accel e.g. pm_airaccelerate) * DeltaTime
-    // Or, if the article's 'a' (2.56) is a constant representing max potential accel in one ideal frame tick for the formulas:
-    // return MaxWishSpeed * AirAccelerationFactor * (1.f/125.f); // if you want to tie to 125fps theory constant
-    return MaxWishSpeed * (IsFalling() ? AirAccelerationFactor : GroundAccelerationFactor) * DeltaTime;
+    // a = s * accel * T as in the strafe-jumping analysis (2.56 for s = 320, pm_airaccelerate = 1, T = 1/125).
+    return GetStrafeTelemetry().EffectiveAccelerationA;
 }
 
 FStrafeAngleInfo UStrafeMovementComponent::GetStrafeAngleInfo() const
 {
-    FStrafeAngleInfo Info;
-    FVector2D WorldVel2D = GetWorldVelocity2D(); // Use world vectors for delta calculation
-    FVector2D WorldWish2D = GetWorldWishDirection2D(); // Use world vectors for delta calculation
-    float CurrentSpeed = WorldVel2D.Size();
-    float S = GetSpeedCapS();
-    float A = GetEffectiveAccelerationA();
-
-    if (CurrentSpeed < KINDA_SMALL_NUMBER || S < KINDA_SMALL_NUMBER) {
-        return Info;
-    }
-
-    if (WorldWish2D.IsNearlyZero()) {
-        Info.CurrentDeltaDegrees = 0.f;
-    }
-    else {
-        float DotProduct = FVector2D::DotProduct(WorldVel2D.GetSafeNormal(), WorldWish2D.GetSafeNormal());
-        Info.CurrentDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(DotProduct, -1.f, 1.f)));
-    }
-
-    float CosDeltaOpt = (S - A) / CurrentSpeed;
-    Info.OptimalDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosDeltaOpt, -1.f, 1.f)));
-
-    float CosDeltaMin = S / CurrentSpeed;
-    Info.MinDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosDeltaMin, -1.f, 1.f)));
-    if (S >= CurrentSpeed) Info.MinDeltaDegrees = 0.f;
-
-    float CosDeltaMaxGain = -A / (2 * CurrentSpeed);
-    Info.MaxGainDeltaDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosDeltaMaxGain, -1.f, 1.f)));
-
-    return Info;
+    return GetStrafeTelemetry().AngleInfo;
 }
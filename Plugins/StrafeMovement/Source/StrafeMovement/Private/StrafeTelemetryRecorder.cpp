@@ -0,0 +1,185 @@
+#include "StrafeTelemetryRecorder.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Event.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+namespace StrafeTelemetryFile
+{
+    /** "STL1" - identifies the file and the FStrafeTelemetryRecord layout. */
+    constexpr uint32 Magic = 0x53544C31;
+    constexpr uint32 Version = 1;
+
+    /** How long the writer sleeps between drains when nothing wakes it. */
+    constexpr uint32 DrainIntervalMs = 10;
+}
+
+TWeakPtr<FStrafeTelemetryRecorder> FStrafeTelemetryRecorder::SharedRecorders[2];
+
+TSharedPtr<FStrafeTelemetryRecorder> FStrafeTelemetryRecorder::Acquire(EStrafeTelemetryFormat Format)
+{
+    check(IsInGameThread());
+
+    const int32 FormatIndex = static_cast<int32>(Format);
+    if (!ensure(FormatIndex < UE_ARRAY_COUNT(SharedRecorders)))
+    {
+        return nullptr;
+    }
+
+    // Keyed by format: a component asking for CSV must not silently get the binary file someone else opened.
+    TWeakPtr<FStrafeTelemetryRecorder>& SharedRecorder = SharedRecorders[FormatIndex];
+    if (TSharedPtr<FStrafeTelemetryRecorder> Existing = SharedRecorder.Pin())
+    {
+        return Existing;
+    }
+
+    TSharedPtr<FStrafeTelemetryRecorder> Recorder = MakeShareable(new FStrafeTelemetryRecorder(Format));
+    if (!Recorder->Start())
+    {
+        return nullptr;
+    }
+    SharedRecorder = Recorder;
+    return Recorder;
+}
+
+FStrafeTelemetryRecorder::FStrafeTelemetryRecorder(EStrafeTelemetryFormat InFormat)
+    : Format(InFormat)
+    , Ring(RingCapacity)
+{
+}
+
+FStrafeTelemetryRecorder::~FStrafeTelemetryRecorder()
+{
+    if (Thread)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    // The writer has stopped; whatever it didn't get to is ours now.
+    Drain();
+
+    if (FileHandle)
+    {
+        FileHandle->Flush(true);
+        FileHandle.Reset();
+        UE_LOG(LogTemp, Log, TEXT("FStrafeTelemetryRecorder: Closed %s (%llu records dropped)."), *FilePath, GetDroppedRecords());
+    }
+
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+}
+
+bool FStrafeTelemetryRecorder::Start()
+{
+    const FString Directory = FPaths::ProjectSavedDir() / TEXT("StrafeTelemetry");
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*Directory);
+
+    const TCHAR* Extension = Format == EStrafeTelemetryFormat::Csv ? TEXT("csv") : TEXT("stl");
+    FilePath = Directory / FString::Printf(TEXT("StrafeTelemetry_%s.%s"), *FDateTime::Now().ToString(), Extension);
+
+    FileHandle.Reset(PlatformFile.OpenWrite(*FilePath));
+    if (!FileHandle)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FStrafeTelemetryRecorder: Could not open %s for writing."), *FilePath);
+        return false;
+    }
+    WriteHeader();
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("StrafeTelemetryWriter"), 0, TPri_BelowNormal);
+    if (!Thread)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FStrafeTelemetryRecorder: Could not start the writer thread."));
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStrafeTelemetryRecorder: Recording movement telemetry to %s."), *FilePath);
+    return true;
+}
+
+void FStrafeTelemetryRecorder::WriteHeader()
+{
+    if (Format == EStrafeTelemetryFormat::Csv)
+    {
+        const FTCHARToUTF8 Header(TEXT("WorldTime,MoveTimeStamp,MoverId,LocX,LocY,LocZ,VelX,VelY,VelZ,WishX,WishY,StrafeDeltaDeg,DeltaTime,MovementMode,OnGround,JustLanded,Authority,LocallyControlled,Frame\n"));
+        FileHandle->Write(reinterpret_cast<const uint8*>(Header.Get()), Header.Length());
+        return;
+    }
+
+    const uint32 Header[] = { StrafeTelemetryFile::Magic, StrafeTelemetryFile::Version, sizeof(FStrafeTelemetryRecord) };
+    FileHandle->Write(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+}
+
+bool FStrafeTelemetryRecorder::Push(const FStrafeTelemetryRecord& Record)
+{
+    if (Ring.Enqueue(Record))
+    {
+        return true;
+    }
+    DroppedRecords.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+uint32 FStrafeTelemetryRecorder::Run()
+{
+    while (!bStopRequested.load(std::memory_order_acquire))
+    {
+        WakeEvent->Wait(StrafeTelemetryFile::DrainIntervalMs);
+        Drain();
+    }
+    return 0;
+}
+
+void FStrafeTelemetryRecorder::Stop()
+{
+    bStopRequested.store(true, std::memory_order_release);
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FStrafeTelemetryRecorder::Drain()
+{
+    if (!FileHandle || Ring.IsEmpty())
+    {
+        return;
+    }
+
+    WriteBuffer.Reset();
+    FStrafeTelemetryRecord Record;
+    while (Ring.Dequeue(Record))
+    {
+        if (Format == EStrafeTelemetryFormat::Binary)
+        {
+            WriteBuffer.Append(reinterpret_cast<const uint8*>(&Record), sizeof(Record));
+            continue;
+        }
+
+        const FString Line = FString::Printf(TEXT("%.6f,%.6f,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.5f,%.5f,%.4f,%.6f,%u,%d,%d,%d,%d,%u\n"),
+            Record.WorldTime, Record.MoveTimeStamp, Record.MoverId,
+            Record.Location.X, Record.Location.Y, Record.Location.Z,
+            Record.Velocity.X, Record.Velocity.Y, Record.Velocity.Z,
+            Record.WishDirection.X, Record.WishDirection.Y,
+            Record.StrafeDeltaDegrees, Record.DeltaTime, Record.MovementMode,
+            (Record.Flags & EStrafeTelemetryFlags::OnGround) != 0,
+            (Record.Flags & EStrafeTelemetryFlags::JustLanded) != 0,
+            (Record.Flags & EStrafeTelemetryFlags::Authority) != 0,
+            (Record.Flags & EStrafeTelemetryFlags::LocallyControlled) != 0,
+            Record.FrameNumber);
+        const FTCHARToUTF8 Utf8Line(*Line);
+        WriteBuffer.Append(reinterpret_cast<const uint8*>(Utf8Line.Get()), Utf8Line.Length());
+    }
+
+    if (WriteBuffer.Num() > 0)
+    {
+        FileHandle->Write(WriteBuffer.GetData(), WriteBuffer.Num());
+    }
+}
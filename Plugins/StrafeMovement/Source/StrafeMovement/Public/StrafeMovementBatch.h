@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StrafePhysicsKernel.h"
+
+/**
+ * Structure-of-arrays form of the StrafePhysics velocity phase (friction, acceleration, ground clamp, gravity)
+ * for many movers at once. Lanes are padded to a multiple of four and evaluated four at a time with
+ * VectorRegister4Float, so the per-mover cost is a handful of SIMD instructions instead of a chain of
+ * virtual calls and scalar FVector math.
+ *
+ * Batching must match the scalar path exactly: results are StrafePhysics::ApplyFriction / ApplyAcceleration /
+ * ClampHorizontalSpeed to within float rounding, with the same horizontal (XY) projections, so a mover moving
+ * between the batch and UStrafeMovementComponent's scalar path never changes speed. Change both together.
+ * Collision is not part of the batch; each mover still sweeps on its own.
+ */
+struct STRAFEMOVEMENT_API FStrafeMovementBatch
+{
+    /** Clears all lanes, keeping the allocations. */
+    void Reset();
+
+    /**
+     * Appends one mover and returns its lane index.
+     * @param Velocity        Current velocity.
+     * @param WishDirection   Normalized horizontal wish direction, or zero.
+     * @param WishSpeed       Speed the mover wants to reach along WishDirection.
+     * @param Params          Tunables; GravityZ is only used for airborne lanes.
+     * @param bOnGround       Walking (friction, ground acceleration, clamp) vs falling (gravity, air acceleration).
+     * @param bJustLanded     Landing frame: no friction and no ground clamp.
+     */
+    int32 Add(const FVector& Velocity, const FVector& WishDirection, float WishSpeed, const FStrafeMoveParams& Params, bool bOnGround, bool bJustLanded);
+
+    /** Runs the velocity phase for every lane. */
+    void Integrate(float DeltaTime);
+
+    FVector GetVelocity(int32 Lane) const { return FVector(VelX[Lane], VelY[Lane], VelZ[Lane]); }
+
+    int32 Num() const { return NumLanes; }
+
+private:
+    using FLaneArray = TArray<float, TAlignedHeapAllocator<16>>;
+
+    int32 NumLanes = 0;
+
+    FLaneArray VelX;
+    FLaneArray VelY;
+    FLaneArray VelZ;
+    FLaneArray WishX;
+    FLaneArray WishY;
+    FLaneArray WishSpeed;
+    /** Ground or air acceleration factor, whichever applies to the lane. */
+    FLaneArray Accel;
+    FLaneArray Friction;
+    FLaneArray StopSpeed;
+    FLaneArray MaxGroundSpeed;
+    /** GravityZ for airborne lanes, 0 for grounded ones. */
+    FLaneArray Gravity;
+    /** 1 where friction and the ground clamp apply (grounded and not on the landing frame), else 0. */
+    FLaneArray GroundControl;
+
+    void AddPaddingLane();
+};
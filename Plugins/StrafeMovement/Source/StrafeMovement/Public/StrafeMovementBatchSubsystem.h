@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "StrafeMovementBatch.h"
+#include "StrafeMovementBatchSubsystem.generated.h"
+
+class UStrafeMovementComponent;
+class UStrafeMovementBatchSubsystem;
+
+/** Pre-physics tick that runs the batched velocity phase ahead of every registered movement component. */
+USTRUCT()
+struct FStrafeMovementBatchTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UStrafeMovementBatchSubsystem* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FStrafeMovementBatchTickFunction> : public TStructOpsTypeTraitsBase2<FStrafeMovementBatchTickFunction>
+{
+    enum { WithCopy = false };
+};
+
+/**
+ * Batches the acceleration / friction / gravity phase of server-simulated strafe movers (bots, AI).
+ *
+ * Once per frame, before any movement component ticks, it gathers every eligible registered component
+ * into an FStrafeMovementBatch, evaluates the velocity phase with SIMD, and hands each component its
+ * result. PhysWalking / PhysFalling then only do their collision sweep. A component uses the batched
+ * velocity only if nothing it depends on changed in between (delta time, movement mode, velocity, wish
+ * direction); otherwise it runs the scalar path, so behaviour never diverges.
+ *
+ * Player-controlled pawns are never batched: their moves are driven by client timestamps and replays.
+ */
+UCLASS()
+class STRAFEMOVEMENT_API UStrafeMovementBatchSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    /** Adds a component to the batch and makes its tick depend on the batch tick. */
+    void RegisterComponent(UStrafeMovementComponent* Component);
+
+    void UnregisterComponent(UStrafeMovementComponent* Component);
+
+    /** Number of components that were evaluated in the last batch. */
+    int32 GetLastBatchSize() const { return LastBatchSize; }
+
+protected:
+    friend struct FStrafeMovementBatchTickFunction;
+
+    void RunBatch(float DeltaTime);
+
+    FStrafeMovementBatchTickFunction BatchTickFunction;
+
+    TArray<TWeakObjectPtr<UStrafeMovementComponent>> RegisteredComponents;
+
+    /** Reused between frames: the SoA lanes and the component each lane belongs to. */
+    FStrafeMovementBatch Batch;
+    TArray<UStrafeMovementComponent*> BatchedComponents;
+
+    int32 LastBatchSize = 0;
+};
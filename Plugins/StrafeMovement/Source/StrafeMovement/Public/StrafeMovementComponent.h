@@ -2,11 +2,43 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "StrafePhysicsKernel.h"
+#include "StrafeTelemetryRecorder.h"
 #include "StrafeMovementComponent.generated.h"
 
 // Forward declaration for our custom saved move
 class FSavedMove_Strafe;
 
+/**
+ * FStrafeNetworkMoveData
+ *
+ * Per-move payload sent to the server. Adds the strafe state the server needs to replay the move exactly
+ * (jump held, landing frame) as two bits, and replaces the full FVector_NetQuantize10 acceleration with a
+ * 16-bit yaw and a half-precision magnitude whenever the acceleration is horizontal (walking and falling).
+ * The client quantizes its wish direction the same way before simulating, so nothing is lost.
+ */
+struct STRAFEMOVEMENT_API FStrafeNetworkMoveData : public FCharacterNetworkMoveData
+{
+    typedef FCharacterNetworkMoveData Super;
+
+    bool bStrafeJumpHeld = false;
+    bool bJustLandedFrame = false;
+
+    virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+
+protected:
+    void SerializeAcceleration(FArchive& Ar, UPackageMap* PackageMap, bool& bOutSuccess);
+};
+
+/** Holds the new/pending/old FStrafeNetworkMoveData a ServerMove may carry. */
+struct STRAFEMOVEMENT_API FStrafeNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+    FStrafeNetworkMoveDataContainer();
+
+    FStrafeNetworkMoveData StrafeMoveData[3];
+};
+
 /**
  * Enum for movement presets
  */
@@ -37,6 +69,51 @@ struct FStrafeAngleInfo
     FStrafeAngleInfo() : CurrentDeltaDegrees(0.f), OptimalDeltaDegrees(0.f), MinDeltaDegrees(0.f), MaxGainDeltaDegrees(0.f) {}
 };
 
+/**
+ * Everything the strafe HUD shows, computed once per frame from the last physics step.
+ * Bind widgets and view models to this instead of the individual getters to share the math.
+ */
+USTRUCT(BlueprintType)
+struct FStrafeTelemetry
+{
+    GENERATED_BODY()
+
+    /** Horizontal speed in uu/s. */
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    float Speed2D = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    FVector2D WorldVelocity2D = FVector2D::ZeroVector;
+
+    /** Normalized, or zero without input. */
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    FVector2D WorldWishDirection2D = FVector2D::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    FVector2D WorldPlayerOrientation2D = FVector2D::ZeroVector;
+
+    /** Velocity and wish direction rotated so the player's forward is +X. */
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    FVector2D PlayerRelativeVelocity2D = FVector2D::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    FVector2D PlayerRelativeWishDirection2D = FVector2D::ZeroVector;
+
+    /** Speed cap s (MaxWishSpeed). */
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    float SpeedCapS = 0.f;
+
+    /** Per-step acceleration a = s * accel * T, with T the last physics step. */
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    float EffectiveAccelerationA = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    FStrafeAngleInfo AngleInfo;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Strafe Telemetry")
+    bool bOnGround = false;
+};
+
 /**
  * UStrafeMovementComponent
  *
@@ -54,6 +131,8 @@ public:
 
     //~ Begin UActorComponent Interface
     virtual void InitializeComponent() override;
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     //~ End UActorComponent Interface
 
     //~ Begin UCharacterMovementComponent Interface
@@ -64,12 +143,18 @@ public:
     virtual void CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration) override;
     virtual bool DoJump(bool bReplayingMoves) override;
     virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+    virtual void SimulateMovement(float DeltaTime) override;
     //~ End UCharacterMovementComponent Interface
 
     //~ Begin INetworkPredictionInterface Interface
     virtual class FNetworkPredictionData_Client* GetPredictionData_Client() const override;
     //~ End INetworkPredictionInterface Interface
 
+    //~ Begin UCharacterMovementComponent Networking Interface
+    virtual float GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const override;
+    virtual void SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation) override;
+    //~ End UCharacterMovementComponent Networking Interface
+
     /** Applies a velocity impulse, useful for knockback or special jump pads. */
     UFUNCTION(BlueprintCallable, Category = "Strafe Movement|Impulses")
     void ApplyStrafeImpulse(const FVector& Impulse, bool bVelocityChange);
@@ -82,10 +167,38 @@ public:
     UFUNCTION(BlueprintPure, Category = "Strafe Movement|Debug")
     float GetWishSpeed() const { return CurrentWishSpeed; }
 
+    /** Starts pushing one FStrafeTelemetryRecord per movement tick to the shared telemetry recorder. */
+    UFUNCTION(BlueprintCallable, Category = "Strafe Movement|Telemetry")
+    void StartTelemetryRecording();
+
+    UFUNCTION(BlueprintCallable, Category = "Strafe Movement|Telemetry")
+    void StopTelemetryRecording();
+
+    UFUNCTION(BlueprintPure, Category = "Strafe Movement|Telemetry")
+    bool IsRecordingTelemetry() const { return TelemetryRecorder.IsValid(); }
 
+    /** Snapshot of the current tunables, for running the StrafePhysics kernel outside the component (bots, replay). */
+    FStrafeMoveParams GetStrafeMoveParams() const;
 
+    /** Walking floor updates since the last reset: how many reused the cached floor and how many swept. */
+    UFUNCTION(BlueprintPure, Category = "Strafe Movement|Debug")
+    void GetFloorCacheStats(int32& OutHits, int32& OutSweeps) const { OutHits = FloorCacheHits; OutSweeps = FloorCacheSweeps; }
+
+    UFUNCTION(BlueprintCallable, Category = "Strafe Movement|Debug")
+    void ResetFloorCacheStats() { FloorCacheHits = 0; FloorCacheSweeps = 0; KnownStepHits = 0; }
+
+    /** Step-ups since the last reset that took the single-sweep known-step path. */
+    UFUNCTION(BlueprintPure, Category = "Strafe Movement|Debug")
+    int32 GetKnownStepHits() const { return KnownStepHits; }
 
 
+
+
+
+    /** HUD telemetry for this frame. Computed on the first call per frame and shared by every later caller. */
+    UFUNCTION(BlueprintPure, Category = "Strafe Movement|HUD")
+    const FStrafeTelemetry& GetStrafeTelemetry() const;
+
     UFUNCTION(BlueprintPure, Category = "Strafe Movement|HUD|WorldSpace")
     FVector2D GetWorldVelocity2D() const;
 
@@ -120,8 +233,32 @@ public:
 protected:
     //~ Begin UCharacterMovementComponent Protected Interface
     virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+    virtual FVector ConstrainInputAcceleration(const FVector& InputAcceleration) const override;
+    virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+    virtual void ControlledCharacterMove(const FVector& InputVector, float DeltaSeconds) override;
+    virtual void OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity) override;
     //~ End UCharacterMovementComponent Protected Interface
 
+    /** True for remote players on this machine when bUseStrafeProxySmoothing is on. */
+    bool IsStrafeSmoothedProxy() const;
+
+    /** Server: pushes the owner to clients now, on events that break the proxies' extrapolation. */
+    void ForceProxyUpdate();
+
+    /** World time of the last replicated position for this proxy. */
+    double LastProxyUpdateTime;
+
+    /** Shared recorder while recording; see FStrafeTelemetryRecorder. */
+    TSharedPtr<FStrafeTelemetryRecorder> TelemetryRecorder;
+
+    void PushTelemetryRecord(float DeltaSeconds);
+
+    /** Storage for the custom ServerMove payload; registered in the constructor. */
+    FStrafeNetworkMoveDataContainer StrafeMoveDataContainer;
+
+    /** Server: whether the previous replayed move ended airborne, to validate the client's landing-frame claim. */
+    bool bServerWasFallingLastMove;
+
     /** Core Quake-style acceleration logic. */
     virtual void ApplyStrafeAcceleration(const FVector& WishDirection, float WishSpeed, float AccelerationParam, float DeltaTime);
 
@@ -142,6 +279,29 @@ protected:
      */
     virtual bool TryStrafeStepUp(const FHitResult& InitialBlockHit, const FVector& PreFrameLocation, const FVector& PreFrameVelocity, float DeltaTime);
 
+    /** Query params for the step-up sweeps, built once per owner instead of per sweep. */
+    const FCollisionQueryParams& GetStepUpQueryParams();
+
+    /** True if BlockHit is a face contact higher than QuakeStepHeight above the capsule bottom, so no step can clear it. */
+    bool IsUnsteppableWall(const FHitResult& BlockHit, float ImpactHeight) const;
+
+    /**
+     * Step-up against geometry we already climbed successfully: lift straight onto the edge that was hit and
+     * do the remaining move, one sweep instead of the up / forward / down sequence.
+     */
+    bool TryKnownStepUp(const FHitResult& BlockHit, float ImpactHeight, const FVector& PreFrameVelocity, float DeltaTime);
+
+    /** Records a static primitive that was climbed by the full step-up path. */
+    void RememberKnownStep(const UPrimitiveComponent* StepComponent);
+
+    FCollisionQueryParams StepUpQueryParams;
+    const ACharacter* StepUpQueryParamsOwner;
+
+    /** Most recently climbed static primitives, oldest first. A handful covers every staircase in view. */
+    static constexpr int32 MaxKnownSteps = 8;
+    TArray<TWeakObjectPtr<const UPrimitiveComponent>, TInlineAllocator<MaxKnownSteps>> KnownStepComponents;
+    int32 KnownStepHits;
+
 
     UPROPERTY()
     EStrafeMovementPreset CurrentMovementPreset;
@@ -185,25 +345,144 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Stepping", Config, meta = (EditCondition = "bEnableQuakeStepLogic", ClampMin = "0.0"))
     float QuakeStepHeight;
 
+    /** Blocking hits whose normal Z is within +/- this are walls (faces, not edges); see TryStrafeStepUp. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Stepping", Config, meta = (EditCondition = "bEnableQuakeStepLogic", ClampMin = "0.0", ClampMax = "1.0"))
+    float StepUpWallNormalZ;
+
+    // --- Fixed Timestep ---
+
+    /**
+     * Simulate locally controlled movement in fixed steps of 1 / FixedTimestepHz instead of once per rendered frame.
+     * Quake air acceleration gain depends on the step length, so this makes jump distance and top speed
+     * independent of frame rate, and caps the number of simulated (and sent) moves per second.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Fixed Timestep", Config)
+    bool bUseFixedTimestep;
+
+    /** Simulation rate in fixed-step mode. 125 Hz matches the classic com_maxfps 125 physics. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Fixed Timestep", Config, meta = (EditCondition = "bUseFixedTimestep", ClampMin = "10.0", ClampMax = "1000.0"))
+    float FixedTimestepHz;
+
+    /** Most steps run in one frame; time beyond that is dropped instead of spiralling on hitches. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Fixed Timestep", Config, meta = (EditCondition = "bUseFixedTimestep", ClampMin = "1"))
+    int32 MaxFixedStepsPerFrame;
+
+    /**
+     * Between steps, offset the mesh so it is drawn between the last two simulated positions.
+     * The capsule stays at the simulated position, so this is purely visual and local.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Fixed Timestep", Config, meta = (EditCondition = "bUseFixedTimestep"))
+    bool bInterpolateFixedSteps;
+
+    // --- Networking ---
+
+    /**
+     * Saved moves whose wish directions differ by less than this may be combined into one ServerMove,
+     * provided the combined move reaches the same velocity (see MoveCombineMaxVelocityError).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Networking", Config, meta = (ClampMin = "0.0", ClampMax = "45.0"))
+    float MoveCombineAngleToleranceDegrees;
+
+    /**
+     * Largest velocity difference (uu/s) allowed between simulating two moves back to back and simulating
+     * them as one combined move. Keeps air-strafe gain exact regardless of how much the client combines.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Networking", Config, meta = (ClampMin = "0.0"))
+    float MoveCombineMaxVelocityError;
+
+    /** Upper bound on regular ServerMoves per second from a client. Important moves are always sent. 0 = engine default. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Networking", Config, meta = (ClampMin = "0.0"))
+    float MaxServerMovesPerSecond;
+
+    // --- Simulated Proxies ---
+
+    /**
+     * Strafe-aware extrapolation for remote players: coast on the replicated velocity on the ground, follow the
+     * ballistic arc in the air, predict the next hop when a fast mover lands, and blend corrections that scale
+     * with speed instead of snapping. The server forces a net update on every jump and landing, so the arc
+     * proxies extrapolate is only wrong between updates by the air strafing itself.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Simulated Proxies", Config)
+    bool bUseStrafeProxySmoothing;
+
+    /**
+     * Opt-in. When above 0, the server sets this NetUpdateFrequency on the owning character while proxy smoothing is on,
+     * replacing what the character class configured. 0 leaves the character's own value. Around 30 is enough for
+     * smoothed proxies, since jumps and landings force their own updates.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Simulated Proxies", Config, meta = (EditCondition = "bUseStrafeProxySmoothing", ClampMin = "0.0"))
+    float ProxySmoothedNetUpdateFrequency;
+
+    /** A proxy landing faster than MaxWishSpeed times this is assumed to hop straight away. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Simulated Proxies", Config, meta = (EditCondition = "bUseStrafeProxySmoothing", ClampMin = "1.0"))
+    float ProxyHopSpeedRatio;
+
+    /** Longest a proxy keeps extrapolating without hearing from the server. 0 = no limit. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Simulated Proxies", Config, meta = (EditCondition = "bUseStrafeProxySmoothing", ClampMin = "0.0"))
+    float ProxyMaxExtrapolationTime;
+
+    /** Corrections up to speed times this many seconds are blended rather than snapped. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Simulated Proxies", Config, meta = (EditCondition = "bUseStrafeProxySmoothing", ClampMin = "0.0"))
+    float ProxyCorrectionSpeedWindow;
+
+    // --- Performance ---
+
+    /**
+     * Let UStrafeMovementBatchSubsystem compute this mover's velocity phase together with all other
+     * server-simulated movers (bots). Ignored for player-controlled pawns.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Performance", Config)
+    bool bAllowBatchedMovement;
+
+    /**
+     * While walking on a flat, static floor, reuse the last floor sweep instead of sweeping again every tick.
+     * The cached floor is only trusted within FloorCacheMaxDistance of where it was swept, at the same height,
+     * inside the floor primitive's bounds and for at most FloorCacheMaxReuses ticks in a row.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Performance", Config)
+    bool bEnableFloorCache;
+
+    /** Horizontal distance from the last real sweep within which the cached floor is reused. Also bounds how far past a hole in the floor mesh a mover can walk before noticing it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Performance", Config, meta = (EditCondition = "bEnableFloorCache", ClampMin = "0.0"))
+    float FloorCacheMaxDistance;
+
+    /** Largest height change since the last real sweep that still counts as the same floor. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Performance", Config, meta = (EditCondition = "bEnableFloorCache", ClampMin = "0.0"))
+    float FloorCacheHeightTolerance;
+
+    /** Consecutive reuses before a real sweep is forced, so a floor removed from under a stationary mover is noticed. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Performance", Config, meta = (EditCondition = "bEnableFloorCache", ClampMin = "0"))
+    int32 FloorCacheMaxReuses;
+
+    // --- Telemetry ---
+
+    /** Record movement telemetry from BeginPlay. Meant for tuning sessions, not shipping servers. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Telemetry", Config)
+    bool bRecordTelemetry;
+
+    /** Used by whichever component starts the shared recorder; later components join its file. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Strafe Movement|Telemetry", Config)
+    EStrafeTelemetryFormat TelemetryFormat;
+
     // --- Movement Presets Data (Example) ---
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_MaxWishSpeed = 320.f;
+    float ClassicQuake_MaxWishSpeed = TStrafePreset<FStrafePresetTag_ClassicQuake>::MaxWishSpeed;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_GroundFrictionFactor = 6.f;
+    float ClassicQuake_GroundFrictionFactor = TStrafePreset<FStrafePresetTag_ClassicQuake>::GroundFrictionFactor;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_GroundStopSpeed = 100.f;
+    float ClassicQuake_GroundStopSpeed = TStrafePreset<FStrafePresetTag_ClassicQuake>::GroundStopSpeed;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_GroundAccelerationFactor = 10.f;
+    float ClassicQuake_GroundAccelerationFactor = TStrafePreset<FStrafePresetTag_ClassicQuake>::GroundAccelerationFactor;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_AirAccelerationFactor = 1.f;
+    float ClassicQuake_AirAccelerationFactor = TStrafePreset<FStrafePresetTag_ClassicQuake>::AirAccelerationFactor;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
     bool ClassicQuake_bAirAccelerationAllowsExceedingMaxWishSpeed = true;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_StrafeJumpImpulse = 270.f;
+    float ClassicQuake_StrafeJumpImpulse = TStrafePreset<FStrafePresetTag_ClassicQuake>::StrafeJumpImpulse;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
     bool ClassicQuake_bEnableQuakeStepLogic = true;
     UPROPERTY(EditDefaultsOnly, Category = "Strafe Movement|Presets|ClassicQuake")
-    float ClassicQuake_QuakeStepHeight = 18.f;
+    float ClassicQuake_QuakeStepHeight = TStrafePreset<FStrafePresetTag_ClassicQuake>::StepHeight;
 
 
 protected:
@@ -222,6 +501,73 @@ protected:
     UPROPERTY()
     bool bJustLandedFrame;
 
+    // --- HUD telemetry ---
+
+    /** Length of the last PhysWalking / PhysFalling step, the T in the strafe formulas. */
+    float LastPhysicsStepDeltaTime;
+
+    mutable FStrafeTelemetry CachedTelemetry;
+    mutable uint64 CachedTelemetryFrame;
+
+    void ComputeStrafeTelemetry(FStrafeTelemetry& OutTelemetry) const;
+
+    // --- Floor cache state ---
+
+    /** Capsule location of the last real floor sweep; the cached floor is CurrentFloor shifted from there. */
+    FVector FloorCacheAnchorLocation;
+    bool bFloorCacheValid;
+    int32 FloorCacheReuseCount;
+    int32 FloorCacheHits;
+    int32 FloorCacheSweeps;
+
+    /** PhysWalking's end-of-move floor update: reuses CurrentFloor when it provably still applies, otherwise FindFloor. */
+    void UpdateWalkingFloor();
+
+    /** True if CurrentFloor, swept at FloorCacheAnchorLocation, is still the floor at CapsuleLocation. */
+    bool CanReuseFloor(const FVector& CapsuleLocation) const;
+
+    // --- Fixed timestep state ---
+
+    float FixedStepAccumulator;
+    FVector FixedStepPreviousLocation;
+    /** Capsule location after the last step; finding the capsule anywhere else later means something moved it. */
+    FVector FixedStepCurrentLocation;
+    /** True while the mesh carries an interpolation offset. */
+    bool bFixedStepVisualApplied;
+
+    /** Removes the mesh interpolation offset and rebases the step locations if something else moved the capsule. */
+    void RestoreFixedStepLocation();
+
+    /** Offsets the mesh to the interpolated position Alpha of the way through the current step. */
+    void ApplyFixedStepInterpolation(float Alpha);
+
+    // --- Batched velocity phase (see UStrafeMovementBatchSubsystem) ---
+    friend class UStrafeMovementBatchSubsystem;
+
+    /**
+     * Fills the batch inputs for this frame and records what they were based on.
+     * Returns false if this mover must run the scalar path (player controlled, not walking/falling, root motion...).
+     */
+    bool GatherBatchInput(float DeltaTime, FVector& OutWishDirection, float& OutWishSpeed, bool& bOutOnGround);
+
+    /** Stores the batched velocity to be picked up by the next PhysWalking / PhysFalling. */
+    void ReceiveBatchedVelocity(const FVector& InVelocity);
+
+    /**
+     * Replaces the friction/acceleration/gravity phase with the batched result if it was computed from
+     * exactly the state we are about to simulate. Consumes the result either way.
+     */
+    bool ConsumeBatchedVelocity(float DeltaTime, const FVector& WishDirection);
+
+    bool bHasBatchedVelocity;
+    uint64 BatchedFrameCounter;
+    float BatchedDeltaTime;
+    TEnumAsByte<EMovementMode> BatchedMovementMode;
+    bool bBatchedJustLanded;
+    FVector BatchedInputVelocity;
+    FVector BatchedWishDirection;
+    FVector BatchedVelocity;
+
 public:
     // For FSavedMove_Strafe to access
     bool GetIsStrafeJumpHeld() const { return bStrafeJumpHeld; }
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Stateless Quake-style movement math shared by UStrafeMovementComponent and anything that needs to
+ * simulate strafing without a world: bots, benchmarks, ghost/prediction replay, automation tests.
+ *
+ * Everything here operates on plain values and structs, allocates nothing and touches no UObject,
+ * so it can be stepped millions of times per second on any thread.
+ * The functions mirror Quake III's bg_pmove.c (PM_Friction, PM_Accelerate, PM_ClipVelocity).
+ */
+
+/** Tunables for one simulation step. Filled from the component, or from a compile-time preset. */
+struct FStrafeMoveParams
+{
+    /** Q3 ps->speed. */
+    float MaxWishSpeed = 320.f;
+    /** Q3 pm_friction. */
+    float GroundFrictionFactor = 6.f;
+    /** Q3 pm_stopspeed. */
+    float GroundStopSpeed = 100.f;
+    /** Q3 pm_accelerate. */
+    float GroundAccelerationFactor = 10.f;
+    /** Q3 pm_airaccelerate. */
+    float AirAccelerationFactor = 1.f;
+    /** Horizontal speed cap while walking (crouch already applied). Not applied on the landing frame. */
+    float MaxGroundSpeed = 320.f;
+    /** Signed Z acceleration while airborne, in uu/s^2. */
+    float GravityZ = -980.f;
+};
+
+/** Minimal kinematic state the kernel advances. */
+struct FStrafeKinematicState
+{
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    bool bOnGround = false;
+    /** Q3 skips friction on the frame the player lands, which is what makes bunny hopping work. */
+    bool bJustLanded = false;
+};
+
+/** Player intent for one step. WishDirection must be normalized or zero. */
+struct FStrafeMoveInput
+{
+    FVector WishDirection = FVector::ZeroVector;
+    float WishSpeed = 0.f;
+};
+
+namespace StrafePhysics
+{
+    /** PM_Friction for the horizontal plane. Velocities below 1 uu/s snap to zero. */
+    FORCEINLINE void ApplyFriction(FVector& Velocity, float StopSpeed, float Friction, float DeltaTime)
+    {
+        const float Speed = Velocity.Size2D();
+        if (Speed < 1.0f)
+        {
+            Velocity.X = 0.f;
+            Velocity.Y = 0.f;
+            return;
+        }
+
+        const float Control = Speed < StopSpeed ? StopSpeed : Speed;
+        const float Drop = Control * Friction * DeltaTime;
+        const float Scale = FMath::Max(Speed - Drop, 0.f) / Speed;
+        Velocity.X *= Scale;
+        Velocity.Y *= Scale;
+    }
+
+    /**
+     * PM_Accelerate. Only adds speed along WishDirection while the projected speed is below WishSpeed,
+     * and never more than that in one step. Speed is measured against horizontal velocity on the ground and in
+     * the air alike, so walking up or down a slope (non-zero Z velocity) doesn't change how fast a mover gets.
+     * Only X and Y are changed; Z belongs to gravity and jumping.
+     */
+    FORCEINLINE void ApplyAcceleration(FVector& Velocity, const FVector& WishDirection, float WishSpeed, float Acceleration, float DeltaTime)
+    {
+        if (WishDirection.IsNearlyZero() || WishSpeed <= 0.f || Acceleration <= 0.f || DeltaTime <= 0.f)
+        {
+            return;
+        }
+
+        const float CurrentSpeed = Velocity.X * WishDirection.X + Velocity.Y * WishDirection.Y;
+        const float AddSpeed = WishSpeed - CurrentSpeed;
+        if (AddSpeed <= 0.f)
+        {
+            return;
+        }
+
+        const float AccelSpeed = FMath::Min(Acceleration * DeltaTime * WishSpeed, AddSpeed);
+        Velocity.X += AccelSpeed * WishDirection.X;
+        Velocity.Y += AccelSpeed * WishDirection.Y;
+    }
+
+    /** Scales horizontal velocity down to MaxSpeed if it is above it. */
+    FORCEINLINE void ClampHorizontalSpeed(FVector& Velocity, float MaxSpeed)
+    {
+        const float SpeedSquared = Velocity.X * Velocity.X + Velocity.Y * Velocity.Y;
+        if (SpeedSquared > FMath::Square(MaxSpeed))
+        {
+            const float Scale = MaxSpeed * FMath::InvSqrt(SpeedSquared);
+            Velocity.X *= Scale;
+            Velocity.Y *= Scale;
+        }
+    }
+
+    /** PM_ClipVelocity: removes the component into the surface, slightly overbounced so we don't stay in contact. */
+    FORCEINLINE FVector ClipVelocity(const FVector& InVelocity, const FVector& ImpactNormal, float Overbounce = 1.001f)
+    {
+        const float Backoff = FVector::DotProduct(InVelocity, ImpactNormal);
+        if (Backoff < 0.f)
+        {
+            return InVelocity - ImpactNormal * (Backoff * Overbounce);
+        }
+        return InVelocity;
+    }
+
+    /**
+     * Snaps the yaw of a horizontal vector to 16 bits (~0.0055 deg), keeping its length and Z.
+     * Wish directions are quantized this way before simulation so the 16-bit value sent upstream
+     * reproduces exactly what the client simulated. Vectors with a vertical component are returned as is.
+     */
+    FORCEINLINE FVector QuantizePlanarDirection(const FVector& InVector)
+    {
+        if (InVector.Z != 0.f)
+        {
+            return InVector;
+        }
+        const float Size = InVector.Size2D();
+        if (Size <= 0.f)
+        {
+            return FVector::ZeroVector;
+        }
+        const uint16 QuantizedYaw = FRotator::CompressAxisToShort(FMath::RadiansToDegrees(FMath::Atan2(InVector.Y, InVector.X)));
+        float SinYaw, CosYaw;
+        FMath::SinCos(&SinYaw, &CosYaw, FMath::DegreesToRadians(FRotator::DecompressAxisFromShort(QuantizedYaw)));
+        return FVector(CosYaw * Size, SinYaw * Size, 0.f);
+    }
+
+    /**
+     * One collision-free movement step: friction and ground acceleration when grounded,
+     * gravity and air acceleration when airborne, then integration.
+     * Ground contact and landing are the caller's business (trace, or a known floor height).
+     */
+    FORCEINLINE void Step(FStrafeKinematicState& State, const FStrafeMoveInput& Input, const FStrafeMoveParams& Params, float DeltaTime)
+    {
+        if (State.bOnGround)
+        {
+            if (!State.bJustLanded)
+            {
+                ApplyFriction(State.Velocity, Params.GroundStopSpeed, Params.GroundFrictionFactor, DeltaTime);
+            }
+            ApplyAcceleration(State.Velocity, Input.WishDirection, Input.WishSpeed, Params.GroundAccelerationFactor, DeltaTime);
+            if (!State.bJustLanded)
+            {
+                ClampHorizontalSpeed(State.Velocity, Params.MaxGroundSpeed);
+            }
+            State.bJustLanded = false;
+        }
+        else
+        {
+            State.Velocity.Z += Params.GravityZ * DeltaTime;
+            ApplyAcceleration(State.Velocity, Input.WishDirection, Input.WishSpeed, Params.AirAccelerationFactor, DeltaTime);
+        }
+        State.Location += State.Velocity * DeltaTime;
+    }
+}
+
+/**
+ * Compile-time movement presets. Specialize TStrafePreset for a new ruleset and use TStrafeKernel<Tag>
+ * so the tunables are folded into the instruction stream instead of being loaded per step.
+ */
+struct FStrafePresetTag_ClassicQuake {};
+
+template <typename PresetTag>
+struct TStrafePreset;
+
+template <>
+struct TStrafePreset<FStrafePresetTag_ClassicQuake>
+{
+    static constexpr float MaxWishSpeed = 320.f;
+    static constexpr float GroundFrictionFactor = 6.f;
+    static constexpr float GroundStopSpeed = 100.f;
+    static constexpr float GroundAccelerationFactor = 10.f;
+    static constexpr float AirAccelerationFactor = 1.f;
+    static constexpr float StrafeJumpImpulse = 270.f;
+    static constexpr float StepHeight = 18.f;
+};
+
+template <typename PresetTag>
+struct TStrafeKernel
+{
+    using Preset = TStrafePreset<PresetTag>;
+
+    static FStrafeMoveParams MakeParams(float GravityZ = -980.f)
+    {
+        FStrafeMoveParams Params;
+        Params.MaxWishSpeed = Preset::MaxWishSpeed;
+        Params.GroundFrictionFactor = Preset::GroundFrictionFactor;
+        Params.GroundStopSpeed = Preset::GroundStopSpeed;
+        Params.GroundAccelerationFactor = Preset::GroundAccelerationFactor;
+        Params.AirAccelerationFactor = Preset::AirAccelerationFactor;
+        Params.MaxGroundSpeed = Preset::MaxWishSpeed;
+        Params.GravityZ = GravityZ;
+        return Params;
+    }
+
+    static FORCEINLINE void ApplyFriction(FVector& Velocity, float DeltaTime)
+    {
+        StrafePhysics::ApplyFriction(Velocity, Preset::GroundStopSpeed, Preset::GroundFrictionFactor, DeltaTime);
+    }
+
+    static FORCEINLINE void ApplyGroundAcceleration(FVector& Velocity, const FVector& WishDirection, float DeltaTime)
+    {
+        StrafePhysics::ApplyAcceleration(Velocity, WishDirection, Preset::MaxWishSpeed, Preset::GroundAccelerationFactor, DeltaTime);
+    }
+
+    static FORCEINLINE void ApplyAirAcceleration(FVector& Velocity, const FVector& WishDirection, float DeltaTime)
+    {
+        StrafePhysics::ApplyAcceleration(Velocity, WishDirection, Preset::MaxWishSpeed, Preset::AirAccelerationFactor, DeltaTime);
+    }
+
+    static FORCEINLINE void Step(FStrafeKinematicState& State, const FVector& WishDirection, float DeltaTime, float GravityZ = -980.f)
+    {
+        FStrafeMoveInput Input;
+        Input.WishDirection = WishDirection;
+        Input.WishSpeed = Preset::MaxWishSpeed;
+        StrafePhysics::Step(State, Input, MakeParams(GravityZ), DeltaTime);
+    }
+};
+
+using FStrafeKernel_ClassicQuake = TStrafeKernel<FStrafePresetTag_ClassicQuake>;
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/PlatformFile.h"
+#include "Containers/CircularQueue.h"
+#include <atomic>
+#include "StrafeTelemetryRecorder.generated.h"
+
+class FRunnableThread;
+class FEvent;
+
+/** On-disk format of a telemetry recording. */
+UENUM(BlueprintType)
+enum class EStrafeTelemetryFormat : uint8
+{
+    /** Header followed by raw FStrafeTelemetryRecord structs. Compact; what the analysis scripts read. */
+    Binary,
+    /** One line per record, for spreadsheets and quick looks. */
+    Csv
+};
+
+/** Bits of FStrafeTelemetryRecord::Flags. */
+namespace EStrafeTelemetryFlags
+{
+    constexpr uint8 OnGround = 1 << 0;
+    constexpr uint8 JustLanded = 1 << 1;
+    /** Recorded on the server (or standalone); otherwise on the owning client. */
+    constexpr uint8 Authority = 1 << 2;
+    constexpr uint8 LocallyControlled = 1 << 3;
+}
+
+/**
+ * One movement tick as written to disk. Fixed layout, no padding surprises: the binary file is just
+ * a header and a sequence of these, readable with a numpy dtype or a C struct.
+ */
+struct FStrafeTelemetryRecord
+{
+    /** World time on the recording machine. */
+    double WorldTime;
+    /** Move timestamp shared by client and server for the same move (0 for unreplicated movers). Use this to line up divergence. */
+    float MoveTimeStamp;
+    /** PlayerState id, or the object id for movers without one. */
+    uint32 MoverId;
+    FVector3f Location;
+    FVector3f Velocity;
+    /** Horizontal wish direction, normalized or zero. */
+    FVector2f WishDirection;
+    /** Angle between horizontal velocity and wish direction, in degrees. */
+    float StrafeDeltaDegrees;
+    float DeltaTime;
+    uint8 MovementMode;
+    uint8 Flags;
+    uint16 Reserved;
+    /** Low bits of GFrameCounter; frames with several fixed steps share it. */
+    uint32 FrameNumber;
+};
+static_assert(sizeof(FStrafeTelemetryRecord) == 64, "FStrafeTelemetryRecord is a file format; update the version when its layout changes.");
+
+/**
+ * Streams movement telemetry to Saved/StrafeTelemetry without touching the disk on the game thread.
+ *
+ * Movement components push records into a bounded lock-free ring (TCircularQueue). A background thread
+ * drains it every few milliseconds and writes binary or CSV. When the ring is full, records are dropped
+ * and counted rather than blocking the game thread.
+ *
+ * The ring is single-producer: Push must only be called from the game thread, where character movement ticks.
+ * One recorder per format is shared by every recording component in the process, so a PIE session with a
+ * listen server and clients ends up with server and client records of the same moves in one file.
+ * Components asking for different formats get separate recorders and files.
+ */
+class STRAFEMOVEMENT_API FStrafeTelemetryRecorder : public FRunnable
+{
+public:
+    /** Returns the shared recorder for Format, starting it (and its file) if nobody is recording in that format yet. */
+    static TSharedPtr<FStrafeTelemetryRecorder> Acquire(EStrafeTelemetryFormat Format);
+
+    virtual ~FStrafeTelemetryRecorder() override;
+
+    /** Game thread only. Returns false if the ring was full and the record was dropped. */
+    bool Push(const FStrafeTelemetryRecord& Record);
+
+    uint64 GetDroppedRecords() const { return DroppedRecords.load(std::memory_order_relaxed); }
+
+    const FString& GetFilePath() const { return FilePath; }
+
+    //~ Begin FRunnable Interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+    //~ End FRunnable Interface
+
+private:
+    explicit FStrafeTelemetryRecorder(EStrafeTelemetryFormat InFormat);
+
+    bool Start();
+
+    /** Moves everything currently in the ring to disk. Writer thread only (and the destructor, after it stopped). */
+    void Drain();
+
+    void WriteHeader();
+
+    /** ~8 s of 8 movers at 125 Hz. */
+    static constexpr uint32 RingCapacity = 8192;
+
+    /** The live recorder of each format, indexed by EStrafeTelemetryFormat; owners hold strong references. */
+    static TWeakPtr<FStrafeTelemetryRecorder> SharedRecorders[2];
+
+    EStrafeTelemetryFormat Format;
+    FString FilePath;
+    TUniquePtr<IFileHandle> FileHandle;
+
+    TCircularQueue<FStrafeTelemetryRecord> Ring;
+
+    /** Reused between drains: raw records (binary) or UTF-8 lines (CSV). */
+    TArray<uint8> WriteBuffer;
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    std::atomic<bool> bStopRequested{ false };
+    std::atomic<uint64> DroppedRecords{ 0 };
+};
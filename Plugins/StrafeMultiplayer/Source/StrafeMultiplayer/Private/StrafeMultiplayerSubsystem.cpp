@@ -102,12 +102,15 @@ void UStrafeMultiplayerSubsystem::FindLobbies()
     LastLobbySearch->MaxSearchResults = 10000;
     LastLobbySearch->bIsLanQuery = IOnlineSubsystem::Get()->GetSubsystemName() == "NULL";
     LastLobbySearch->QuerySettings.Set(SEARCH_LOBBIES, true, EOnlineComparisonOp::Equals);
+    ReportedLobbyResults = 0;
 
     if (!SessionInterface->FindSessions(*LocalPlayer->GetPreferredUniqueNetId(), LastLobbySearch.ToSharedRef()))
     {
         SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindLobbiesCompleteDelegateHandle);
         OnFindLobbiesComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), EMultiplayerSessionResult::Find_FindRequestFailed);
+        return;
     }
+    StartSearchProgressPolling();
 }
 
 void UStrafeMultiplayerSubsystem::FindDedicatedServers()
@@ -131,12 +134,65 @@ void UStrafeMultiplayerSubsystem::FindDedicatedServers()
     LastDedicatedSearch = MakeShareable(new FOnlineSessionSearch());
     LastDedicatedSearch->MaxSearchResults = 1000;
     LastDedicatedSearch->bIsLanQuery = IOnlineSubsystem::Get()->GetSubsystemName() == "NULL";
+    ReportedDedicatedResults = 0;
 
     if (!SessionInterface->FindSessions(*LocalPlayer->GetPreferredUniqueNetId(), LastDedicatedSearch.ToSharedRef()))
     {
         SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindDedicatedServersCompleteDelegateHandle);
         OnFindDedicatedServersComplete.Broadcast(TArray<FOnlineSessionSearchResult>(), EMultiplayerSessionResult::Find_FindRequestFailed);
+        return;
+    }
+    StartSearchProgressPolling();
+}
+
+void UStrafeMultiplayerSubsystem::Deinitialize()
+{
+    if (SearchProgressTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SearchProgressTickerHandle);
+        SearchProgressTickerHandle.Reset();
+    }
+    Super::Deinitialize();
+}
+
+void UStrafeMultiplayerSubsystem::StartSearchProgressPolling()
+{
+    if (!SearchProgressTickerHandle.IsValid())
+    {
+        SearchProgressTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &ThisClass::PollSearchProgress), 0.05f);
+    }
+}
+
+bool UStrafeMultiplayerSubsystem::PollSearchProgress(float DeltaTime)
+{
+    bool bAnySearchRunning = false;
+
+    if (LastLobbySearch.IsValid() && LastLobbySearch->SearchState == EOnlineAsyncTaskState::InProgress)
+    {
+        bAnySearchRunning = true;
+        if (LastLobbySearch->SearchResults.Num() > ReportedLobbyResults)
+        {
+            ReportedLobbyResults = LastLobbySearch->SearchResults.Num();
+            OnFindSessionsProgress.Broadcast(LastLobbySearch->SearchResults, false);
+        }
+    }
+
+    if (LastDedicatedSearch.IsValid() && LastDedicatedSearch->SearchState == EOnlineAsyncTaskState::InProgress)
+    {
+        bAnySearchRunning = true;
+        if (LastDedicatedSearch->SearchResults.Num() > ReportedDedicatedResults)
+        {
+            ReportedDedicatedResults = LastDedicatedSearch->SearchResults.Num();
+            OnFindSessionsProgress.Broadcast(LastDedicatedSearch->SearchResults, true);
+        }
+    }
+
+    if (!bAnySearchRunning)
+    {
+        SearchProgressTickerHandle.Reset();
     }
+    return bAnySearchRunning;
 }
 
 
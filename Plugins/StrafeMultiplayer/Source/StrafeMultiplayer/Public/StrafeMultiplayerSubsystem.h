@@ -5,12 +5,15 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Interfaces/OnlineSessionInterface.h"
+#include "Containers/Ticker.h"
 #include "MultiplayerSessionTypes.h"
 #include "StrafeMultiplayerSubsystem.generated.h"
 
 // Custom delegates using the new result enums
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FStrafeOnCreateSessionComplete, EMultiplayerSessionResult, Result);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FStrafeOnFindSessionsComplete, const TArray<FOnlineSessionSearchResult>& /*SessionResults*/, EMultiplayerSessionResult /*Result*/);
+/** Fired while a search is running, whenever the online subsystem has added results. Carries everything found so far. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FStrafeOnFindSessionsProgress, const TArray<FOnlineSessionSearchResult>& /*SearchResultsSoFar*/, bool /*bDedicatedSearch*/);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FStrafeOnJoinSessionComplete, EMultiplayerSessionResult /*Result*/, const FString& /*ConnectString*/);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FStrafeOnDestroySessionComplete, EMultiplayerSessionResult, Result);
 
@@ -29,10 +32,13 @@ public:
     void JoinSession(const FOnlineSessionSearchResult& SessionResult);
     void DestroySession();
 
+    virtual void Deinitialize() override;
+
     // Delegate Handles now use the corrected, unique names
     FStrafeOnCreateSessionComplete OnCreateSessionComplete;
     FStrafeOnFindSessionsComplete OnFindLobbiesComplete;
     FStrafeOnFindSessionsComplete OnFindDedicatedServersComplete;
+    FStrafeOnFindSessionsProgress OnFindSessionsProgress;
     FStrafeOnJoinSessionComplete OnJoinSessionComplete;
     FStrafeOnDestroySessionComplete OnDestroySessionComplete;
 
@@ -46,6 +52,18 @@ protected:
 private:
     bool IsSessionInterfaceValid();
 
+    /**
+     * Most online subsystems append to FOnlineSessionSearch::SearchResults as responses arrive but only report
+     * once the whole search is done. While a search runs we poll the array and forward what is new, so the
+     * browser can show the first servers long before a 10000-result query finishes.
+     */
+    void StartSearchProgressPolling();
+    bool PollSearchProgress(float DeltaTime);
+
+    FTSTicker::FDelegateHandle SearchProgressTickerHandle;
+    int32 ReportedLobbyResults{ 0 };
+    int32 ReportedDedicatedResults{ 0 };
+
     IOnlineSessionPtr SessionInterface;
     TSharedPtr<FOnlineSessionSettings> LastSessionSettings;
     TSharedPtr<FOnlineSessionSearch> LastLobbySearch;
@@ -0,0 +1,62 @@
+// Plugins/StrafeUI/Source/StrafeReplayStreaming/Private/StrafeReplayStreaming.cpp
+
+#include "StrafeReplayStreaming.h"
+#include "Misc/Compression.h"
+
+namespace StrafeReplayCompression
+{
+    /** Compressed chunks are [int32 UncompressedSize][Oodle data]. */
+    constexpr int32 HeaderSize = sizeof(int32);
+
+    /** Sanity limit so a corrupt size field cannot trigger a huge allocation. */
+    constexpr int32 MaxChunkSize = 256 * 1024 * 1024;
+}
+
+bool FStrafeCompressedReplayStreamer::CompressBuffer(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed) const
+{
+    const int32 UncompressedSize = InBuffer.Num();
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, UncompressedSize);
+
+    OutCompressed.SetNumUninitialized(StrafeReplayCompression::HeaderSize + CompressedSize);
+    FMemory::Memcpy(OutCompressed.GetData(), &UncompressedSize, StrafeReplayCompression::HeaderSize);
+
+    // Chunks are written every few seconds while recording; favour speed over ratio.
+    if (!FCompression::CompressMemory(NAME_Oodle, OutCompressed.GetData() + StrafeReplayCompression::HeaderSize, CompressedSize,
+        InBuffer.GetData(), UncompressedSize, COMPRESS_BiasSpeed))
+    {
+        OutCompressed.Reset();
+        return false;
+    }
+
+    OutCompressed.SetNum(StrafeReplayCompression::HeaderSize + CompressedSize, EAllowShrinking::No);
+    return true;
+}
+
+bool FStrafeCompressedReplayStreamer::DecompressBuffer(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer) const
+{
+    if (InCompressed.Num() < StrafeReplayCompression::HeaderSize)
+    {
+        return false;
+    }
+
+    int32 UncompressedSize = 0;
+    FMemory::Memcpy(&UncompressedSize, InCompressed.GetData(), StrafeReplayCompression::HeaderSize);
+    if (UncompressedSize < 0 || UncompressedSize > StrafeReplayCompression::MaxChunkSize)
+    {
+        return false;
+    }
+
+    OutBuffer.SetNumUninitialized(UncompressedSize);
+    return FCompression::UncompressMemory(NAME_Oodle, OutBuffer.GetData(), UncompressedSize,
+        InCompressed.GetData() + StrafeReplayCompression::HeaderSize, InCompressed.Num() - StrafeReplayCompression::HeaderSize);
+}
+
+TSharedPtr<INetworkReplayStreamer> FStrafeReplayStreamingModule::CreateReplayStreamer()
+{
+    // The base factory ticks and releases the streamers it tracks.
+    TSharedPtr<FStrafeCompressedReplayStreamer> Streamer = MakeShared<FStrafeCompressedReplayStreamer>();
+    LocalFileStreamers.Add(Streamer);
+    return Streamer;
+}
+
+IMPLEMENT_MODULE(FStrafeReplayStreamingModule, StrafeReplayStreaming)
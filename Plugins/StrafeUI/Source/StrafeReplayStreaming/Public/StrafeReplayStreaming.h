@@ -0,0 +1,34 @@
+// Plugins/StrafeUI/Source/StrafeReplayStreaming/Public/StrafeReplayStreaming.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LocalFileNetworkReplayStreaming.h"
+
+/**
+ * Local file replay streamer that compresses stream, checkpoint and event chunks with Oodle.
+ *
+ * The local file streamer already moves every chunk write and read onto its async worker tasks; compression
+ * happens inside those tasks, so neither recording nor seeking pays for it on the game thread.
+ * Files record whether they are compressed, so uncompressed replays recorded before this streamer still play.
+ */
+class STRAFEREPLAYSTREAMING_API FStrafeCompressedReplayStreamer : public FLocalFileNetworkReplayStreamer
+{
+public:
+    virtual bool SupportsCompression() const override { return true; }
+    virtual bool CompressBuffer(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed) const override;
+    virtual bool DecompressBuffer(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer) const override;
+};
+
+/**
+ * Replay streaming factory for FStrafeCompressedReplayStreamer.
+ * Selected per recording or playback with the option "ReplayStreamerOverride=StrafeReplayStreaming".
+ */
+class FStrafeReplayStreamingModule : public FLocalFileNetworkReplayStreamingFactory
+{
+public:
+    /** Name to pass as ReplayStreamerOverride. */
+    static const TCHAR* GetStreamerName() { return TEXT("StrafeReplayStreaming"); }
+
+    virtual TSharedPtr<INetworkReplayStreamer> CreateReplayStreamer() override;
+};
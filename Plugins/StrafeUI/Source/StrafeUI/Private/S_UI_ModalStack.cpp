@@ -7,22 +7,43 @@
 #include "Data/S_UI_ScreenTypes.h"
 
 
+namespace ModalStackQueue
+{
+	/** Pending requests the ring buffer holds before it first has to grow. */
+	constexpr int32 InitialCapacity = 4;
+}
+
 void US_UI_ModalStack::Initialize(US_UI_Subsystem* InSubsystem, TSoftClassPtr<US_UI_ModalWidget> InModalWidgetClass)
 {
 	check(InSubsystem);
 	UISubsystem = InSubsystem;
 	ModalWidgetClass = InModalWidgetClass;
+
+	ModalRequestQueue.SetNum(ModalStackQueue::InitialCapacity);
+	QueueHead = 0;
+	QueueCount = 0;
 }
 
 void US_UI_ModalStack::QueueModal(const F_UIModalPayload& Payload, const FOnModalDismissedSignature& OnDismissedCallback)
 {
-	ModalRequestQueue.Add({ Payload, OnDismissedCallback });
+	EnqueueRequest(Payload, OnDismissedCallback);
 	TryDisplayNextModal();
 }
 
+void US_UI_ModalStack::PrewarmModalWidgets(APlayerController* OwningPlayer)
+{
+	if (OwningPlayer && ModalWidgetClass.IsValid())
+	{
+		if (US_UI_ModalWidget* Modal = AcquireModalWidget(OwningPlayer))
+		{
+			ReleaseModalWidget(Modal);
+		}
+	}
+}
+
 void US_UI_ModalStack::TryDisplayNextModal()
 {
-    if (ActiveModal || ModalRequestQueue.Num() == 0)
+    if (ActiveModal || QueueCount == 0)
     {
         return;
     }
@@ -31,34 +52,25 @@ void US_UI_ModalStack::TryDisplayNextModal()
     if (!ModalWidgetClass.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("ModalStack: ModalWidgetClass is not valid! This should have been set during initialization."));
-        if (ModalRequestQueue.Num() > 0)
-        {
-            ModalRequestQueue.RemoveAt(0);
-        }
+        DequeueRequest();
         return;
     }
 
-    const F_UIModalRequest& NextRequest = ModalRequestQueue[0];
-
     APlayerController* PC = UISubsystem->GetGameInstance()->GetFirstLocalPlayerController();
     if (!PC)
     {
         return;
     }
 
-    // Use Get() since we know it's already loaded
-    US_UI_ModalWidget* NewModal = CreateWidget<US_UI_ModalWidget>(PC, ModalWidgetClass.Get());
-    if (NewModal)
+    F_UIModalRequest NextRequest = DequeueRequest();
+    if (US_UI_ModalWidget* Modal = AcquireModalWidget(PC))
     {
-        ActiveModal = NewModal;
-        ActiveModalDismissedCallback = NextRequest.OnDismissedCallback;
+        ActiveModal = Modal;
+        ActiveModalDismissedCallback = MoveTemp(NextRequest.OnDismissedCallback);
 
-        NewModal->SetupModal(NextRequest.Payload);
-        NewModal->OnDismissed.AddDynamic(this, &US_UI_ModalStack::OnModalDismissed);
-        NewModal->AddToViewport(100); // High Z-order to ensure it's on top
+        Modal->SetupModal(NextRequest.Payload);
+        Modal->AddToViewport(100); // High Z-order to ensure it's on top
     }
-
-    ModalRequestQueue.RemoveAt(0);
 }
 
 void US_UI_ModalStack::OnModalDismissed(bool bConfirmed)
@@ -70,11 +82,87 @@ void US_UI_ModalStack::OnModalDismissed(bool bConfirmed)
 
 	if (ActiveModal)
 	{
-		// The widget handles its own RemoveFromParent()
+		// The widget removes itself from the viewport before broadcasting, so it can be reused right away.
+		ReleaseModalWidget(ActiveModal);
 		ActiveModal = nullptr;
 	}
 
 	ActiveModalDismissedCallback.Unbind();
 
 	TryDisplayNextModal();
-}
\ No newline at end of file
+}
+
+US_UI_ModalWidget* US_UI_ModalStack::AcquireModalWidget(APlayerController* OwningPlayer)
+{
+	// Pooled widgets belong to the player they were built for; after a travel they are rebuilt for the new one.
+	ModalWidgetPool.RemoveAll([OwningPlayer](const F_UIPooledModal& Pooled)
+		{
+			return !Pooled.bInUse && (!Pooled.Widget || Pooled.Widget->GetOwningPlayer() != OwningPlayer);
+		});
+
+	for (F_UIPooledModal& Pooled : ModalWidgetPool)
+	{
+		if (!Pooled.bInUse)
+		{
+			Pooled.bInUse = true;
+			return Pooled.Widget;
+		}
+	}
+
+	// Use Get() since we know it's already loaded
+	US_UI_ModalWidget* NewModal = CreateWidget<US_UI_ModalWidget>(OwningPlayer, ModalWidgetClass.Get());
+	if (!NewModal)
+	{
+		return nullptr;
+	}
+
+	NewModal->OnDismissed.AddUniqueDynamic(this, &US_UI_ModalStack::OnModalDismissed);
+
+	F_UIPooledModal& Pooled = ModalWidgetPool.AddDefaulted_GetRef();
+	Pooled.Widget = NewModal;
+	Pooled.SlateWidget = NewModal->TakeWidget();
+	Pooled.bInUse = true;
+	return NewModal;
+}
+
+void US_UI_ModalStack::ReleaseModalWidget(US_UI_ModalWidget* Modal)
+{
+	if (F_UIPooledModal* Pooled = ModalWidgetPool.FindByPredicate([Modal](const F_UIPooledModal& Entry) { return Entry.Widget == Modal; }))
+	{
+		Pooled->bInUse = false;
+	}
+}
+
+void US_UI_ModalStack::EnqueueRequest(const F_UIModalPayload& Payload, const FOnModalDismissedSignature& OnDismissedCallback)
+{
+	if (QueueCount == ModalRequestQueue.Num())
+	{
+		// Unroll into a buffer twice the size so the pending requests start at index 0 again.
+		TArray<F_UIModalRequest> Grown;
+		Grown.SetNum(FMath::Max(ModalRequestQueue.Num() * 2, ModalStackQueue::InitialCapacity));
+		for (int32 Index = 0; Index < QueueCount; ++Index)
+		{
+			Grown[Index] = MoveTemp(ModalRequestQueue[(QueueHead + Index) % ModalRequestQueue.Num()]);
+		}
+		ModalRequestQueue = MoveTemp(Grown);
+		QueueHead = 0;
+	}
+
+	F_UIModalRequest& Slot = ModalRequestQueue[(QueueHead + QueueCount) % ModalRequestQueue.Num()];
+	Slot.Payload = Payload;
+	Slot.OnDismissedCallback = OnDismissedCallback;
+	++QueueCount;
+}
+
+F_UIModalRequest US_UI_ModalStack::DequeueRequest()
+{
+	check(QueueCount > 0);
+
+	// Leave the slot empty so it doesn't keep the callback's captures alive until it is reused.
+	F_UIModalRequest Request = MoveTemp(ModalRequestQueue[QueueHead]);
+	ModalRequestQueue[QueueHead] = F_UIModalRequest();
+
+	QueueHead = (QueueHead + 1) % ModalRequestQueue.Num();
+	--QueueCount;
+	return Request;
+}
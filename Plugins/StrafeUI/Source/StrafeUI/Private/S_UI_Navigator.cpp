@@ -1,15 +1,39 @@
 #include "S_UI_Navigator.h"
 #include "S_UI_AssetManager.h"
+#include "S_UI_Settings.h"
 #include "UI/S_UI_RootWidget.h"
 #include "Widgets/CommonActivatableWidgetContainer.h"
+#include "Blueprint/WidgetTree.h"
 #include "ViewModel/S_UI_ViewModelBase.h"
 #include "UI/S_UI_BaseScreenWidget.h"
 #include "UI/S_UI_FindGameWidget.h"
 #include "UI/S_UI_SettingsWidget.h"
 #include "UI/S_UI_CreateGameWidget.h"
+#include "UI/S_UI_LeaderboardsWidget.h"
+#include "UI/S_UI_ReplaysWidget.h"
+#include "ViewModel/S_UI_VM_Settings.h"
+#include "ViewModel/S_UI_VM_Leaderboards.h"
+#include "ViewModel/S_UI_VM_Replays.h"
+#include "ViewModel/S_UI_VM_ServerBrowser.h"
+
+namespace NavigatorScreenCache
+{
+    /**
+     * Rough cost of one widget: the UWidget, its slot and the Slate widget behind it.
+     * List entries are generated on demand and are not part of the estimate.
+     */
+    constexpr int64 BytesPerWidget = 2 * 1024;
+}
 
 void US_UI_Navigator::Initialize(US_UI_RootWidget* InRootWidget, US_UI_AssetManager* InAssetManager)
 {
+    // Cached screens belong to the previous root's content stack.
+    if (UIRootWidget.Get() != InRootWidget)
+    {
+        PreloadQueue.Reset();
+        ScreenCache.Empty();
+    }
+
     UIRootWidget = InRootWidget;
     AssetManager = InAssetManager;
 
@@ -22,6 +46,17 @@ void US_UI_Navigator::Initialize(US_UI_RootWidget* InRootWidget, US_UI_AssetMana
     }
 }
 
+void US_UI_Navigator::BeginDestroy()
+{
+    if (PreloadTickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PreloadTickHandle);
+        PreloadTickHandle.Reset();
+    }
+
+    Super::BeginDestroy();
+}
+
 void US_UI_Navigator::SwitchContentScreen(E_UIScreenId ScreenId)
 {
     if (!AssetManager.IsValid() || !UIRootWidget.IsValid()) return;
@@ -39,44 +74,52 @@ void US_UI_Navigator::SwitchContentScreen(E_UIScreenId ScreenId)
         return;
     }
 
-    if (!UIRootWidget->GetContentStack())
+    UCommonActivatableWidgetStack* ContentStack = UIRootWidget->GetContentStack();
+    if (!ContentStack)
     {
         UE_LOG(LogTemp, Error, TEXT("Navigator: SwitchContentScreen failed: ContentStack is null."));
         return;
     }
 
-    UIRootWidget->GetContentStack()->ClearWidgets();
+    const double StartTime = FPlatformTime::Seconds();
+    const E_UIScreenId PreviousScreenId = GetActiveScreenId();
+    if (PreviousScreenId == ScreenId)
+    {
+        ScreenCache[ScreenId].LastUsedTime = StartTime;
+        return;
+    }
 
-    if (TSubclassOf<UCommonActivatableWidget> FoundWidgetClass = AssetManager->GetScreenWidgetClass(ScreenId))
+    const bool bWasCached = ScreenCache.Contains(ScreenId);
+    FCachedContentScreen* Screen = FindOrCreateScreen(ScreenId);
+    if (!Screen)
     {
-        UCommonActivatableWidget* PushedWidget = UIRootWidget->GetContentStack()->AddWidget<UCommonActivatableWidget>(FoundWidgetClass);
-        UE_LOG(LogTemp, Verbose, TEXT("Navigator: Switched content screen to: %s"), *UEnum::GetValueAsString(ScreenId));
+        UE_LOG(LogTemp, Error, TEXT("Navigator: SwitchContentScreen failed: No widget class found for ScreenId %s."), *UEnum::GetValueAsString(ScreenId));
+        return;
+    }
+
+    ContentStack->ClearWidgets();
 
-        if (IViewModelProvider* ViewModelProvider = Cast<IViewModelProvider>(PushedWidget))
+    // A screen left and returned to within one stack transition is still on its way out and can't be added twice.
+    bool bJustBuilt = !bWasCached;
+    if (IsOnContentStack(Screen->Widget))
+    {
+        ScreenCache.Remove(ScreenId);
+        Screen = FindOrCreateScreen(ScreenId);
+        if (!Screen)
         {
-            US_UI_ViewModelBase* ViewModel = ViewModelProvider->CreateViewModel();
-            if (US_UI_BaseScreenWidget* BaseScreenWidget = Cast<US_UI_BaseScreenWidget>(PushedWidget))
-            {
-                // This logic is now properly contained within the navigator
-                if (US_UI_FindGameWidget* FindGameWidget = Cast<US_UI_FindGameWidget>(BaseScreenWidget))
-                {
-                    FindGameWidget->SetViewModel(ViewModel);
-                }
-                else if (US_UI_SettingsWidget* SettingsWidget = Cast<US_UI_SettingsWidget>(BaseScreenWidget))
-                {
-                    SettingsWidget->SetViewModel(ViewModel);
-                }
-                else if (US_UI_CreateGameWidget* CreateGameWidget = Cast<US_UI_CreateGameWidget>(BaseScreenWidget))
-                {
-                    CreateGameWidget->SetViewModel(ViewModel);
-                }
-            }
+            return;
         }
+        bJustBuilt = true;
     }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("Navigator: SwitchContentScreen failed: No widget class found for ScreenId %s."), *UEnum::GetValueAsString(ScreenId));
-    }
+    RefreshViewModel(Screen->ViewModel, bJustBuilt);
+
+    ContentStack->AddWidgetInstance(*Screen->Widget);
+    Screen->LastUsedTime = FPlatformTime::Seconds();
+    UE_LOG(LogTemp, Verbose, TEXT("Navigator: Switched content screen to: %s (%s, %.1f ms)"), *UEnum::GetValueAsString(ScreenId),
+        bWasCached ? TEXT("cached") : TEXT("built"), (Screen->LastUsedTime - StartTime) * 1000.0);
+
+    EnforceCacheBudget();
+    SchedulePreload(PreviousScreenId, ScreenId);
 }
 
 void US_UI_Navigator::PopContentScreen()
@@ -89,4 +132,270 @@ void US_UI_Navigator::PopContentScreen()
             UE_LOG(LogTemp, Verbose, TEXT("Navigator: Popping current content screen."));
         }
     }
-}
\ No newline at end of file
+}
+
+void US_UI_Navigator::PreloadScreen(E_UIScreenId ScreenId)
+{
+    if (ScreenId == E_UIScreenId::None || ScreenCache.Contains(ScreenId) || !AssetManager.IsValid() || !AssetManager->AreAssetsLoaded()
+        || !UIRootWidget.IsValid() || !UIRootWidget->GetContentStack())
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    if (const FCachedContentScreen* Screen = FindOrCreateScreen(ScreenId))
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("Navigator: Preloaded %s in %.1f ms (~%lld KB)."), *UEnum::GetValueAsString(ScreenId),
+            (FPlatformTime::Seconds() - StartTime) * 1000.0, Screen->EstimatedBytes / 1024);
+        EnforceCacheBudget();
+    }
+}
+
+void US_UI_Navigator::FlushScreenCache()
+{
+    PreloadQueue.Reset();
+    for (auto It = ScreenCache.CreateIterator(); It; ++It)
+    {
+        if (!IsOnContentStack(It->Value.Widget))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+FCachedContentScreen* US_UI_Navigator::FindOrCreateScreen(E_UIScreenId ScreenId)
+{
+    if (FCachedContentScreen* Cached = ScreenCache.Find(ScreenId))
+    {
+        if (IsValid(Cached->Widget))
+        {
+            return Cached;
+        }
+        ScreenCache.Remove(ScreenId);
+    }
+
+    const TSubclassOf<UCommonActivatableWidget> WidgetClass = AssetManager->GetScreenWidgetClass(ScreenId);
+    if (!WidgetClass)
+    {
+        return nullptr;
+    }
+
+    UCommonActivatableWidget* Widget = CreateWidget<UCommonActivatableWidget>(UIRootWidget->GetContentStack(), WidgetClass);
+    if (!Widget)
+    {
+        return nullptr;
+    }
+
+    FCachedContentScreen& Screen = ScreenCache.Add(ScreenId);
+    Screen.Widget = Widget;
+    Screen.SlateWidget = Widget->TakeWidget();
+
+    if (IViewModelProvider* ViewModelProvider = Cast<IViewModelProvider>(Widget))
+    {
+        Screen.ViewModel = ViewModelProvider->CreateViewModel();
+        BindViewModel(Widget, Screen.ViewModel);
+    }
+
+    Screen.EstimatedBytes = EstimateWidgetBytes(Widget);
+    Screen.LastUsedTime = FPlatformTime::Seconds();
+    return &Screen;
+}
+
+void US_UI_Navigator::BindViewModel(UCommonActivatableWidget* Widget, US_UI_ViewModelBase* ViewModel)
+{
+    if (!ViewModel)
+    {
+        return;
+    }
+
+    if (US_UI_FindGameWidget* FindGameWidget = Cast<US_UI_FindGameWidget>(Widget))
+    {
+        FindGameWidget->SetViewModel(ViewModel);
+    }
+    else if (US_UI_SettingsWidget* SettingsWidget = Cast<US_UI_SettingsWidget>(Widget))
+    {
+        SettingsWidget->SetViewModel(ViewModel);
+    }
+    else if (US_UI_CreateGameWidget* CreateGameWidget = Cast<US_UI_CreateGameWidget>(Widget))
+    {
+        CreateGameWidget->SetViewModel(ViewModel);
+    }
+    else if (US_UI_LeaderboardsWidget* LeaderboardsWidget = Cast<US_UI_LeaderboardsWidget>(Widget))
+    {
+        LeaderboardsWidget->SetViewModel(ViewModel);
+    }
+    else if (US_UI_ReplaysWidget* ReplaysWidget = Cast<US_UI_ReplaysWidget>(Widget))
+    {
+        ReplaysWidget->SetViewModel(ViewModel);
+    }
+}
+
+void US_UI_Navigator::RefreshViewModel(US_UI_ViewModelBase* ViewModel, bool bJustBuilt)
+{
+    // The server browser searches online, so it never searches when built (which may be a background preload),
+    // only here when it is actually shown.
+    if (US_UI_VM_ServerBrowser* ServerBrowserViewModel = Cast<US_UI_VM_ServerBrowser>(ViewModel))
+    {
+        ServerBrowserViewModel->RequestServerListRefresh();
+        return;
+    }
+
+    // The other view models load local data in Initialize.
+    if (bJustBuilt)
+    {
+        return;
+    }
+
+    if (US_UI_VM_Settings* SettingsViewModel = Cast<US_UI_VM_Settings>(ViewModel))
+    {
+        SettingsViewModel->LoadSettings();
+    }
+    else if (US_UI_VM_Leaderboards* LeaderboardsViewModel = Cast<US_UI_VM_Leaderboards>(ViewModel))
+    {
+        LeaderboardsViewModel->RefreshLeaderboard();
+    }
+    else if (US_UI_VM_Replays* ReplaysViewModel = Cast<US_UI_VM_Replays>(ViewModel))
+    {
+        ReplaysViewModel->RefreshReplays();
+    }
+}
+
+int64 US_UI_Navigator::EstimateWidgetBytes(const UUserWidget* Widget)
+{
+    if (!Widget || !Widget->WidgetTree)
+    {
+        return 0;
+    }
+
+    int64 Bytes = NavigatorScreenCache::BytesPerWidget;
+    Widget->WidgetTree->ForEachWidget([&Bytes](UWidget* Child)
+    {
+        const UUserWidget* ChildUserWidget = Cast<UUserWidget>(Child);
+        Bytes += ChildUserWidget ? EstimateWidgetBytes(ChildUserWidget) : NavigatorScreenCache::BytesPerWidget;
+    });
+    return Bytes;
+}
+
+bool US_UI_Navigator::IsOnContentStack(const UCommonActivatableWidget* Widget) const
+{
+    const UCommonActivatableWidgetStack* ContentStack = UIRootWidget.IsValid() ? UIRootWidget->GetContentStack() : nullptr;
+    return ContentStack && Widget && ContentStack->GetWidgetList().Contains(Widget);
+}
+
+E_UIScreenId US_UI_Navigator::GetActiveScreenId() const
+{
+    const UCommonActivatableWidgetStack* ContentStack = UIRootWidget.IsValid() ? UIRootWidget->GetContentStack() : nullptr;
+    const UCommonActivatableWidget* ActiveWidget = ContentStack ? ContentStack->GetActiveWidget() : nullptr;
+    if (ActiveWidget)
+    {
+        for (const TPair<E_UIScreenId, FCachedContentScreen>& Pair : ScreenCache)
+        {
+            if (Pair.Value.Widget == ActiveWidget)
+            {
+                return Pair.Key;
+            }
+        }
+    }
+    return E_UIScreenId::None;
+}
+
+void US_UI_Navigator::SchedulePreload(E_UIScreenId FromScreenId, E_UIScreenId ToScreenId)
+{
+    if (FromScreenId != E_UIScreenId::None)
+    {
+        ++TransitionCounts.FindOrAdd(TPair<E_UIScreenId, E_UIScreenId>(FromScreenId, ToScreenId));
+    }
+
+    const US_UI_Settings* Settings = GetDefault<US_UI_Settings>();
+    PreloadQueue.Reset();
+    if (!Settings->bPreloadLikelyScreens || Settings->MaxPreloadedScreens <= 0 || Settings->ScreenCacheBudgetKB <= 0)
+    {
+        return;
+    }
+
+    // Rank the other screens by how often they followed this one. Until there is history, ties keep enum order.
+    TArray<TPair<int32, E_UIScreenId>> Candidates;
+    const UEnum* ScreenEnum = StaticEnum<E_UIScreenId>();
+    for (int32 Index = 0; Index < ScreenEnum->NumEnums() - 1; ++Index)
+    {
+        const E_UIScreenId Candidate = static_cast<E_UIScreenId>(ScreenEnum->GetValueByIndex(Index));
+        if (Candidate != E_UIScreenId::None && Candidate != ToScreenId)
+        {
+            const int32* Count = TransitionCounts.Find(TPair<E_UIScreenId, E_UIScreenId>(ToScreenId, Candidate));
+            Candidates.Emplace(Count ? *Count : 0, Candidate);
+        }
+    }
+    Candidates.StableSort([](const TPair<int32, E_UIScreenId>& A, const TPair<int32, E_UIScreenId>& B)
+        {
+            return A.Key > B.Key;
+        });
+
+    for (int32 Index = 0; Index < Candidates.Num() && Index < Settings->MaxPreloadedScreens; ++Index)
+    {
+        if (!ScreenCache.Contains(Candidates[Index].Value))
+        {
+            PreloadQueue.Add(Candidates[Index].Value);
+        }
+    }
+
+    // Start next frame so the switch that triggered this isn't made any slower.
+    if (PreloadQueue.Num() > 0 && !PreloadTickHandle.IsValid())
+    {
+        PreloadTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &US_UI_Navigator::HandlePreloadTick));
+    }
+}
+
+bool US_UI_Navigator::HandlePreloadTick(float DeltaTime)
+{
+    if (PreloadQueue.Num() > 0)
+    {
+        const E_UIScreenId ScreenId = PreloadQueue[0];
+        PreloadQueue.RemoveAt(0);
+        PreloadScreen(ScreenId);
+    }
+
+    if (PreloadQueue.Num() == 0)
+    {
+        PreloadTickHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+void US_UI_Navigator::EnforceCacheBudget()
+{
+    const int64 BudgetBytes = static_cast<int64>(FMath::Max(GetDefault<US_UI_Settings>()->ScreenCacheBudgetKB, 0)) * 1024;
+
+    TArray<E_UIScreenId> HiddenScreens;
+    int64 HiddenBytes = 0;
+    for (const TPair<E_UIScreenId, FCachedContentScreen>& Pair : ScreenCache)
+    {
+        if (!IsOnContentStack(Pair.Value.Widget))
+        {
+            HiddenScreens.Add(Pair.Key);
+            HiddenBytes += Pair.Value.EstimatedBytes;
+        }
+    }
+
+    if (HiddenBytes <= BudgetBytes)
+    {
+        return;
+    }
+
+    HiddenScreens.Sort([this](E_UIScreenId A, E_UIScreenId B)
+        {
+            return ScreenCache[A].LastUsedTime < ScreenCache[B].LastUsedTime;
+        });
+
+    // Dropping the entry releases the Slate tree; the widget and view model go with the next GC.
+    for (const E_UIScreenId ScreenId : HiddenScreens)
+    {
+        if (HiddenBytes <= BudgetBytes)
+        {
+            break;
+        }
+        HiddenBytes -= ScreenCache[ScreenId].EstimatedBytes;
+        ScreenCache.Remove(ScreenId);
+        UE_LOG(LogTemp, Verbose, TEXT("Navigator: Evicted cached screen %s to stay within %d KB."), *UEnum::GetValueAsString(ScreenId), GetDefault<US_UI_Settings>()->ScreenCacheBudgetKB);
+    }
+}
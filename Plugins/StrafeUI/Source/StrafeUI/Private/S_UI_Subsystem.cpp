@@ -29,6 +29,8 @@ void US_UI_Subsystem::Initialize(FSubsystemCollectionBase& Collection)
     // Initialize the session manager
     SessionManager->Initialize();
 
+    GetGameInstance()->OnPawnControllerChangedDelegates.AddDynamic(this, &US_UI_Subsystem::HandlePawnControllerChanged);
+
     UE_LOG(LogTemp, Log, TEXT("S_UI_Subsystem Initialized"));
 }
 
@@ -41,6 +43,15 @@ void US_UI_Subsystem::Deinitialize()
         SessionManager = nullptr;
     }
 
+    GetGameInstance()->OnPawnControllerChangedDelegates.RemoveDynamic(this, &US_UI_Subsystem::HandlePawnControllerChanged);
+
+    if (PauseMenuWidgetInstance)
+    {
+        PauseMenuWidgetInstance->RemoveFromParent();
+        PauseMenuWidgetInstance = nullptr;
+    }
+    PauseMenuSlateWidget.Reset();
+
     if (UIRootWidget)
     {
         UIRootWidget->RemoveFromParent();
@@ -128,6 +139,53 @@ void US_UI_Subsystem::FinalizeUIInitialization()
 
     // --- Initialize Navigator ---
     Navigator->Initialize(UIRootWidget, AssetManager);
+
+    PrewarmPooledWidgets(PlayerController);
+}
+
+void US_UI_Subsystem::PrewarmPooledWidgets(APlayerController* PlayerController)
+{
+    if (!PlayerController || !PlayerController->IsLocalController())
+    {
+        return;
+    }
+
+    GetOrCreatePauseMenu(PlayerController);
+
+    if (ModalStack)
+    {
+        ModalStack->PrewarmModalWidgets(PlayerController);
+    }
+}
+
+void US_UI_Subsystem::HandlePawnControllerChanged(APawn* Pawn, AController* Controller)
+{
+    PrewarmPooledWidgets(Cast<APlayerController>(Controller));
+}
+
+US_UI_PauseMenuWidget* US_UI_Subsystem::GetOrCreatePauseMenu(APlayerController* PlayerController)
+{
+    if (PauseMenuWidgetInstance && PauseMenuWidgetInstance->GetOwningPlayer() == PlayerController)
+    {
+        return PauseMenuWidgetInstance;
+    }
+
+    // The class is loaded with the other UI assets; before that there is nothing to build yet.
+    const US_UI_Settings* Settings = GetDefault<US_UI_Settings>();
+    if (!Settings || !Settings->PauseMenuWidgetClass.Get())
+    {
+        return nullptr;
+    }
+
+    // A menu built for a previous player (e.g. before a travel) can't be reused.
+    if (PauseMenuWidgetInstance)
+    {
+        PauseMenuWidgetInstance->RemoveFromParent();
+    }
+
+    PauseMenuWidgetInstance = CreateWidget<US_UI_PauseMenuWidget>(PlayerController, Settings->PauseMenuWidgetClass.Get());
+    PauseMenuSlateWidget = PauseMenuWidgetInstance ? PauseMenuWidgetInstance->TakeWidget().ToSharedPtr() : nullptr;
+    return PauseMenuWidgetInstance;
 }
 
 
@@ -164,8 +222,9 @@ void US_UI_Subsystem::TogglePauseMenu()
     if (PauseMenuWidgetInstance && PauseMenuWidgetInstance->IsInViewport())
     {
         UE_LOG(LogTemp, Log, TEXT("5. [S_UI_Subsystem] Pause menu is visible, removing it."));
+        // The instance stays pooled for the next pause. Its Slate tree is kept, so it won't deactivate on destruct.
+        PauseMenuWidgetInstance->DeactivateWidget();
         PauseMenuWidgetInstance->RemoveFromParent();
-        PauseMenuWidgetInstance = nullptr;
         UGameplayStatics::SetGamePaused(GetWorld(), false);
         FInputModeGameOnly InputMode;
         PC->SetInputMode(InputMode);
@@ -173,7 +232,7 @@ void US_UI_Subsystem::TogglePauseMenu()
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("5. [S_UI_Subsystem] Pause menu not visible. Attempting to create and show."));
+        UE_LOG(LogTemp, Log, TEXT("5. [S_UI_Subsystem] Pause menu not visible. Attempting to show."));
 
         const US_UI_Settings* Settings = GetDefault<US_UI_Settings>();
 
@@ -183,14 +242,13 @@ void US_UI_Subsystem::TogglePauseMenu()
             return;
         }
 
-        UE_LOG(LogTemp, Log, TEXT("6. [S_UI_Subsystem] PauseMenuWidgetClass is valid. Creating widget..."));
-
-        PauseMenuWidgetInstance = CreateWidget<US_UI_PauseMenuWidget>(PC, Settings->PauseMenuWidgetClass.Get());
+        UE_LOG(LogTemp, Log, TEXT("6. [S_UI_Subsystem] PauseMenuWidgetClass is valid. Fetching pooled widget..."));
 
-        if (PauseMenuWidgetInstance)
+        if (US_UI_PauseMenuWidget* PauseMenu = GetOrCreatePauseMenu(PC))
         {
-            UE_LOG(LogTemp, Log, TEXT("7. [S_UI_Subsystem] Widget created successfully. Adding to viewport."));
-            PauseMenuWidgetInstance->AddToViewport(10);
+            UE_LOG(LogTemp, Log, TEXT("7. [S_UI_Subsystem] Pause menu ready. Adding to viewport."));
+            PauseMenu->AddToViewport(10);
+            PauseMenu->ActivateWidget();
             UGameplayStatics::SetGamePaused(GetWorld(), true);
             FInputModeUIOnly InputMode;
             InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
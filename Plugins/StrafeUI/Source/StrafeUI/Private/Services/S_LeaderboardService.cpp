@@ -1,8 +1,9 @@
 // Plugins/StrafeUI/Source/StrafeUI/Private/Services/S_LeaderboardService.cpp
 
 #include "Services/S_LeaderboardService.h"
+#include "Services/S_LeaderboardStore.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
+#include "Engine/GameInstance.h"
 
 void US_LeaderboardService::FetchLeaderboardData(const FString& MapName, TFunction<void(TArray<FLeaderboardEntry>)> OnComplete)
 {
@@ -11,86 +12,70 @@ void US_LeaderboardService::FetchLeaderboardData(const FString& MapName, TFuncti
         return;
     }
 
-    // Cancel any existing timer
-    if (FetchDelayTimerHandle.IsValid())
+    TArray<FLeaderboardEntry> Entries;
+    if (US_LeaderboardStore* Store = GetStore())
     {
-        if (UWorld* World = GetWorld())
-        {
-            World->GetTimerManager().ClearTimer(FetchDelayTimerHandle);
-        }
+        // The store keeps every board sorted, so this is a cheap slice; no need to defer it.
+        Store->GetTopEntries(MapName, US_LeaderboardStore::AnyLayout, MaxFetchedEntries, Entries);
     }
+    OnComplete(MoveTemp(Entries));
+}
 
-    // Simulate network delay (1-2 seconds)
-    float Delay = FMath::RandRange(1.0f, 2.0f);
-
-    if (UWorld* World = GetWorld())
+void US_LeaderboardService::FetchLeaderboardPage(const FString& MapName, int32 FirstRank, int32 Count, TFunction<void(FLeaderboardPage)> OnComplete)
+{
+    if (!OnComplete)
     {
-        World->GetTimerManager().SetTimer(FetchDelayTimerHandle,
-            [this, MapName, OnComplete]()
-            {
-                TArray<FLeaderboardEntry> Data = GenerateMockData(MapName);
-                OnComplete(Data);
-            },
-            Delay, false);
+        return;
     }
-}
 
-TArray<FString> US_LeaderboardService::GetAvailableMapNames() const
-{
-    TArray<FString> MapNames;
-    MapNames.Add(TEXT("DM-Deck"));
-    MapNames.Add(TEXT("DM-Morpheus"));
-    MapNames.Add(TEXT("CTF-Face"));
-    MapNames.Add(TEXT("CTF-Coret"));
-    return MapNames;
+    FLeaderboardPage Page;
+    Page.FirstRank = FMath::Max(FirstRank, 1);
+    if (US_LeaderboardStore* Store = GetStore())
+    {
+        Page.TotalEntries = Store->GetNumEntries(MapName, US_LeaderboardStore::AnyLayout);
+        Store->GetEntries(MapName, US_LeaderboardStore::AnyLayout, Page.FirstRank, Count, Page.Entries);
+    }
+    OnComplete(MoveTemp(Page));
 }
 
-TArray<FLeaderboardEntry> US_LeaderboardService::GenerateMockData(const FString& MapName) const
+void US_LeaderboardService::FetchLeaderboardAroundPlayer(const FString& MapName, const FString& PlayerId, int32 Count, TFunction<void(FLeaderboardPage)> OnComplete)
 {
-    TArray<FLeaderboardEntry> Entries;
-
-    // Generate 10-15 mock entries for the requested map
-    int32 NumEntries = FMath::RandRange(10, 15);
-
-    TArray<FString> PlayerNames = {
-        TEXT("FragMaster"),
-        TEXT("NoobSlayer"),
-        TEXT("ProGamer123"),
-        TEXT("SpeedDemon"),
-        TEXT("HeadshotKing"),
-        TEXT("RocketJumper"),
-        TEXT("SniperElite"),
-        TEXT("BunnyHopper"),
-        TEXT("RailgunGod"),
-        TEXT("FlakMonkey"),
-        TEXT("ShockRifle"),
-        TEXT("InstaGibber"),
-        TEXT("QuakeVet"),
-        TEXT("ArenaChamp"),
-        TEXT("FragHunter")
-    };
-
-    // Shuffle player names for variety
-    for (int32 i = PlayerNames.Num() - 1; i > 0; i--)
+    if (!OnComplete)
     {
-        int32 j = FMath::RandRange(0, i);
-        PlayerNames.Swap(i, j);
+        return;
     }
 
-    // Generate entries with progressively slower times
-    float BaseTime = FMath::RandRange(45.0f, 60.0f);
-
-    for (int32 i = 0; i < NumEntries && i < PlayerNames.Num(); i++)
+    int32 FirstRank = 1;
+    int32 PlayerRank = 0;
+    if (US_LeaderboardStore* Store = GetStore())
     {
-        FLeaderboardEntry Entry;
-        Entry.PlayerName = PlayerNames[i];
-        Entry.MapName = MapName;
-
-        // Each subsequent entry is 0.5-3 seconds slower
-        Entry.Time = BaseTime + (i * FMath::RandRange(0.5f, 3.0f));
+        PlayerRank = Store->GetPlayerRank(MapName, US_LeaderboardStore::AnyLayout, PlayerId);
+        if (PlayerRank > 0)
+        {
+            // Centre the player, but keep the window full when they are near either end of the board.
+            const int32 NumEntries = Store->GetNumEntries(MapName, US_LeaderboardStore::AnyLayout);
+            FirstRank = FMath::Clamp(PlayerRank - Count / 2, 1, FMath::Max(NumEntries - Count + 1, 1));
+        }
+    }
+    FetchLeaderboardPage(MapName, FirstRank, Count, [PlayerRank, OnComplete = MoveTemp(OnComplete)](FLeaderboardPage Page)
+    {
+        Page.PlayerRank = PlayerRank;
+        OnComplete(MoveTemp(Page));
+    });
+}
 
-        Entries.Add(Entry);
+TArray<FString> US_LeaderboardService::GetAvailableMapNames() const
+{
+    if (US_LeaderboardStore* Store = GetStore())
+    {
+        return Store->GetMapNames();
     }
+    return TArray<FString>();
+}
 
-    return Entries;
-}
\ No newline at end of file
+US_LeaderboardStore* US_LeaderboardService::GetStore() const
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<US_LeaderboardStore>() : nullptr;
+}
@@ -0,0 +1,379 @@
+// Plugins/StrafeUI/Source/StrafeUI/Private/Services/S_LeaderboardStore.cpp
+
+#include "Services/S_LeaderboardStore.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Algo/BinarySearch.h"
+
+namespace LeaderboardStoreLog
+{
+    /** "SLB1" - identifies the file and its framing version. */
+    constexpr uint32 Magic = 0x534C4231;
+
+    /** Each record is framed as [uint32 PayloadSize][uint32 PayloadCrc][Payload]. */
+    constexpr int64 FrameHeaderSize = sizeof(uint32) * 2;
+
+    /** Sanity limit so a corrupt size field cannot trigger a huge allocation. */
+    constexpr uint32 MaxPayloadSize = 64 * 1024;
+}
+
+void US_LeaderboardStore::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const double StartTime = FPlatformTime::Seconds();
+    LoadLog();
+
+    UE_LOG(LogTemp, Log, TEXT("US_LeaderboardStore: Loaded %d records across %d boards in %.1f ms."),
+        Records.Num(), Boards.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void US_LeaderboardStore::Deinitialize()
+{
+    if (LogHandle)
+    {
+        LogHandle->Flush(true);
+        LogHandle.Reset();
+    }
+
+    Records.Empty();
+    Boards.Empty();
+    KnownMaps.Empty();
+
+    Super::Deinitialize();
+}
+
+uint64 US_LeaderboardStore::SubmitTime(FLeaderboardRecord Record)
+{
+    if (Record.MapName.IsEmpty() || Record.PlayerId.IsEmpty() || Record.TimeMs <= 0)
+    {
+        return 0;
+    }
+
+    if (Record.LayoutHash == AnyLayout)
+    {
+        Record.LayoutHash = 1;
+    }
+
+    // Only personal bests on the layout board are persisted.
+    const FLeaderboardRecord* ExistingBest = FindPersonalBest(Record.MapName, Record.LayoutHash, Record.PlayerId);
+    if (ExistingBest && ExistingBest->TimeMs <= Record.TimeMs)
+    {
+        return 0;
+    }
+
+    const uint64 SupersededRecordId = ExistingBest ? ExistingBest->RecordId : 0;
+
+    Record.RecordId = NextRecordId++;
+    Record.Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+
+    if (!AppendToLog(Record))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("US_LeaderboardStore: Failed to persist time for %s on %s. It will be kept for this session only."),
+            *Record.PlayerName, *Record.MapName);
+    }
+
+    const int32 RecordIndex = Records.Add(MoveTemp(Record));
+    IndexRecord(RecordIndex);
+
+    // The old personal best is no longer on any board: a faster time on the same layout also replaces it
+    // on the map-wide board. Its side files would otherwise pile up with every improvement.
+    if (SupersededRecordId != 0)
+    {
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const FString GhostPath = GetRecordFilePath(SupersededRecordId, TEXT("ghost"));
+        if (PlatformFile.FileExists(*GhostPath) && !PlatformFile.DeleteFile(*GhostPath))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("US_LeaderboardStore: Failed to delete superseded ghost %s."), *GhostPath);
+        }
+    }
+
+    return Records[RecordIndex].RecordId;
+}
+
+void US_LeaderboardStore::GetTopEntries(const FString& MapName, uint32 LayoutHash, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const
+{
+    GetEntries(MapName, LayoutHash, 1, Count, OutEntries);
+}
+
+void US_LeaderboardStore::GetEntries(const FString& MapName, uint32 LayoutHash, int32 FirstRank, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const
+{
+    const FBoard* Board = FindBoard(MapName, LayoutHash);
+    if (!Board || Count <= 0)
+    {
+        return;
+    }
+
+    const int32 FirstIndex = FMath::Max(FirstRank, 1) - 1;
+    const int32 EndIndex = FMath::Min(FirstIndex + Count, Board->Ranked.Num());
+    if (FirstIndex >= EndIndex)
+    {
+        return;
+    }
+
+    OutEntries.Reserve(OutEntries.Num() + EndIndex - FirstIndex);
+    for (int32 Index = FirstIndex; Index < EndIndex; ++Index)
+    {
+        const FLeaderboardRecord& Record = Records[Board->Ranked[Index].RecordIndex];
+
+        FLeaderboardEntry& Entry = OutEntries.AddDefaulted_GetRef();
+        Entry.PlayerName = Record.PlayerName;
+        Entry.MapName = Record.MapName;
+        Entry.Time = Record.TimeMs / 1000.0f;
+        Entry.Rank = Index + 1;
+        Entry.RecordId = Record.RecordId;
+    }
+}
+
+int32 US_LeaderboardStore::GetPlayerRank(const FString& MapName, uint32 LayoutHash, const FString& PlayerId) const
+{
+    const FBoard* Board = FindBoard(MapName, LayoutHash);
+    const FRankedTime* Best = Board ? Board->BestByPlayer.Find(PlayerId) : nullptr;
+    if (!Best)
+    {
+        return 0;
+    }
+
+    return Algo::LowerBound(Board->Ranked, *Best) + 1;
+}
+
+int32 US_LeaderboardStore::GetNumEntries(const FString& MapName, uint32 LayoutHash) const
+{
+    const FBoard* Board = FindBoard(MapName, LayoutHash);
+    return Board ? Board->Ranked.Num() : 0;
+}
+
+const FLeaderboardRecord* US_LeaderboardStore::FindPersonalBest(const FString& MapName, uint32 LayoutHash, const FString& PlayerId) const
+{
+    const FBoard* Board = FindBoard(MapName, LayoutHash);
+    const FRankedTime* Best = Board ? Board->BestByPlayer.Find(PlayerId) : nullptr;
+    return Best ? &Records[Best->RecordIndex] : nullptr;
+}
+
+TArray<FString> US_LeaderboardStore::GetMapNames() const
+{
+    TArray<FString> MapNames = KnownMaps.Array();
+    MapNames.Sort();
+    return MapNames;
+}
+
+FString US_LeaderboardStore::GetStoreDirectory()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Leaderboards"));
+}
+
+FString US_LeaderboardStore::GetRecordFilePath(uint64 RecordId, const TCHAR* Extension)
+{
+    return FPaths::Combine(GetStoreDirectory(), TEXT("Records"), FString::Printf(TEXT("%llu.%s"), RecordId, Extension));
+}
+
+bool US_LeaderboardStore::IndexRecord(int32 RecordIndex, bool bDeferRanking)
+{
+    const FLeaderboardRecord& Record = Records[RecordIndex];
+
+    FRankedTime NewTime;
+    NewTime.TimeMs = Record.TimeMs;
+    NewTime.RecordIndex = RecordIndex;
+
+    KnownMaps.Add(Record.MapName);
+    FBoard& MapBoard = Boards.FindOrAdd(MakeBoardKey(Record.MapName, AnyLayout));
+    FBoard& LayoutBoard = Boards.FindOrAdd(MakeBoardKey(Record.MapName, Record.LayoutHash));
+
+    if (bDeferRanking)
+    {
+        UpdateBestByPlayer(MapBoard, Record.PlayerId, NewTime);
+        UpdateBestByPlayer(LayoutBoard, Record.PlayerId, NewTime);
+        return true;
+    }
+
+    InsertIntoBoard(MapBoard, Record.PlayerId, NewTime);
+    return InsertIntoBoard(LayoutBoard, Record.PlayerId, NewTime);
+}
+
+void US_LeaderboardStore::UpdateBestByPlayer(FBoard& Board, const FString& PlayerId, const FRankedTime& NewTime)
+{
+    FRankedTime& Best = Board.BestByPlayer.FindOrAdd(PlayerId, NewTime);
+    if (NewTime.TimeMs < Best.TimeMs)
+    {
+        Best = NewTime;
+    }
+}
+
+void US_LeaderboardStore::RebuildRankings()
+{
+    for (TPair<FString, FBoard>& Pair : Boards)
+    {
+        FBoard& Board = Pair.Value;
+        Board.Ranked.Reset(Board.BestByPlayer.Num());
+        for (const TPair<FString, FRankedTime>& Best : Board.BestByPlayer)
+        {
+            Board.Ranked.Add(Best.Value);
+        }
+        Board.Ranked.Sort();
+    }
+}
+
+bool US_LeaderboardStore::InsertIntoBoard(FBoard& Board, const FString& PlayerId, const FRankedTime& NewTime)
+{
+    FRankedTime* ExistingBest = Board.BestByPlayer.Find(PlayerId);
+    if (ExistingBest)
+    {
+        if (ExistingBest->TimeMs <= NewTime.TimeMs)
+        {
+            return false;
+        }
+
+        const int32 OldIndex = Algo::LowerBound(Board.Ranked, *ExistingBest);
+        if (Board.Ranked.IsValidIndex(OldIndex) && Board.Ranked[OldIndex].RecordIndex == ExistingBest->RecordIndex)
+        {
+            Board.Ranked.RemoveAt(OldIndex);
+        }
+        *ExistingBest = NewTime;
+    }
+    else
+    {
+        Board.BestByPlayer.Add(PlayerId, NewTime);
+    }
+
+    Board.Ranked.Insert(NewTime, Algo::LowerBound(Board.Ranked, NewTime));
+    return true;
+}
+
+const US_LeaderboardStore::FBoard* US_LeaderboardStore::FindBoard(const FString& MapName, uint32 LayoutHash) const
+{
+    return Boards.Find(MakeBoardKey(MapName, LayoutHash));
+}
+
+FString US_LeaderboardStore::MakeBoardKey(const FString& MapName, uint32 LayoutHash)
+{
+    return FString::Printf(TEXT("%s#%08x"), *MapName, LayoutHash);
+}
+
+void US_LeaderboardStore::LoadLog()
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*GetStoreDirectory());
+
+    const FString LogPath = GetLogPath();
+    int64 ValidLength = 0;
+
+    if (TUniquePtr<IFileHandle> ReadHandle = TUniquePtr<IFileHandle>(PlatformFile.OpenRead(*LogPath)))
+    {
+        const int64 FileSize = ReadHandle->Size();
+        TArray<uint8> Contents;
+        Contents.SetNumUninitialized(FileSize);
+        if (FileSize > 0 && !ReadHandle->Read(Contents.GetData(), FileSize))
+        {
+            Contents.Reset();
+        }
+
+        uint32 Magic = 0;
+        if (Contents.Num() >= (int32)sizeof(uint32))
+        {
+            FMemory::Memcpy(&Magic, Contents.GetData(), sizeof(uint32));
+        }
+
+        if (Magic == LeaderboardStoreLog::Magic)
+        {
+            int64 Offset = sizeof(uint32);
+            ValidLength = Offset;
+
+            while (Offset + LeaderboardStoreLog::FrameHeaderSize <= Contents.Num())
+            {
+                uint32 PayloadSize = 0;
+                uint32 PayloadCrc = 0;
+                FMemory::Memcpy(&PayloadSize, Contents.GetData() + Offset, sizeof(uint32));
+                FMemory::Memcpy(&PayloadCrc, Contents.GetData() + Offset + sizeof(uint32), sizeof(uint32));
+
+                const int64 PayloadOffset = Offset + LeaderboardStoreLog::FrameHeaderSize;
+                if (PayloadSize > LeaderboardStoreLog::MaxPayloadSize || PayloadOffset + PayloadSize > Contents.Num()
+                    || FCrc::MemCrc32(Contents.GetData() + PayloadOffset, PayloadSize) != PayloadCrc)
+                {
+                    break;
+                }
+
+                TArrayView<const uint8> Payload(Contents.GetData() + PayloadOffset, PayloadSize);
+                FMemoryReaderView Reader(Payload);
+                FLeaderboardRecord Record;
+                Reader << Record;
+                if (Reader.IsError())
+                {
+                    break;
+                }
+
+                // Only the player lookups are updated per record; a per-record sorted insert would make
+                // startup quadratic in the size of the log. The boards are sorted once below.
+                NextRecordId = FMath::Max(NextRecordId, Record.RecordId + 1);
+                const int32 RecordIndex = Records.Add(MoveTemp(Record));
+                IndexRecord(RecordIndex, true);
+
+                Offset = PayloadOffset + PayloadSize;
+                ValidLength = Offset;
+            }
+
+            RebuildRankings();
+
+            if (ValidLength < Contents.Num())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("US_LeaderboardStore: Discarding %lld bytes of torn or corrupt data at the end of %s."),
+                    Contents.Num() - ValidLength, *LogPath);
+            }
+        }
+        else if (Contents.Num() > 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("US_LeaderboardStore: %s is not a leaderboard log. Starting a new one."), *LogPath);
+        }
+    }
+
+    LogHandle.Reset(PlatformFile.OpenWrite(*LogPath, true, true));
+    if (!LogHandle)
+    {
+        UE_LOG(LogTemp, Error, TEXT("US_LeaderboardStore: Could not open %s for writing. Times will not be persisted."), *LogPath);
+        return;
+    }
+
+    // Drop the torn tail (or an unrecognised file) so new records follow the last good one.
+    if (LogHandle->Size() != ValidLength)
+    {
+        LogHandle->Truncate(ValidLength);
+        LogHandle->SeekFromEnd();
+    }
+
+    if (ValidLength == 0)
+    {
+        uint32 Magic = LeaderboardStoreLog::Magic;
+        LogHandle->Write(reinterpret_cast<const uint8*>(&Magic), sizeof(uint32));
+        LogHandle->Flush(true);
+    }
+}
+
+bool US_LeaderboardStore::AppendToLog(const FLeaderboardRecord& Record)
+{
+    if (!LogHandle)
+    {
+        return false;
+    }
+
+    TArray<uint8> Frame;
+    Frame.AddZeroed(LeaderboardStoreLog::FrameHeaderSize);
+    FMemoryWriter Writer(Frame, false, true);
+    Writer.Seek(LeaderboardStoreLog::FrameHeaderSize);
+    Writer << const_cast<FLeaderboardRecord&>(Record);
+
+    const uint32 PayloadSize = Frame.Num() - LeaderboardStoreLog::FrameHeaderSize;
+    const uint32 PayloadCrc = FCrc::MemCrc32(Frame.GetData() + LeaderboardStoreLog::FrameHeaderSize, PayloadSize);
+    FMemory::Memcpy(Frame.GetData(), &PayloadSize, sizeof(uint32));
+    FMemory::Memcpy(Frame.GetData() + sizeof(uint32), &PayloadCrc, sizeof(uint32));
+
+    // A single write of the whole frame, then a full flush: a crash can only ever leave a torn last frame,
+    // which LoadLog detects by its checksum.
+    return LogHandle->Write(Frame.GetData(), Frame.Num()) && LogHandle->Flush(true);
+}
+
+FString US_LeaderboardStore::GetLogPath() const
+{
+    return FPaths::Combine(GetStoreDirectory(), TEXT("StrafeTimes.sldb"));
+}
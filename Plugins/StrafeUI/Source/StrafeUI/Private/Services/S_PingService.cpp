@@ -0,0 +1,212 @@
+// Plugins/StrafeUI/Source/StrafeUI/Private/Services/S_PingService.cpp
+
+#include "Services/S_PingService.h"
+#include "Icmp.h"
+#include "Containers/Ticker.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace PingServiceCache
+{
+    /** "SPC1" - identifies the cache file and its layout. */
+    constexpr uint32 Magic = 0x53504331;
+
+    /** Sanity limit so a corrupt count cannot trigger a huge allocation. */
+    constexpr int32 MaxEntries = 64 * 1024;
+}
+
+void US_PingService::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    LoadCache();
+}
+
+void US_PingService::Deinitialize()
+{
+    CancelPendingPings();
+    if (bCacheDirty)
+    {
+        SaveCache();
+    }
+    PingCache.Empty();
+
+    Super::Deinitialize();
+}
+
+bool US_PingService::GetCachedPing(const FString& HostAddress, int32& OutPingMs) const
+{
+    const FCachedPing* Cached = PingCache.Find(HostAddress);
+    if (!Cached || FDateTime::UtcNow().ToUnixTimestamp() - Cached->MeasuredAt > PingCacheTTLSeconds)
+    {
+        return false;
+    }
+
+    OutPingMs = Cached->PingMs;
+    return true;
+}
+
+void US_PingService::RequestPing(const FString& HostAddress)
+{
+    if (HostAddress.IsEmpty())
+    {
+        return;
+    }
+
+    bool bAlreadyRequested = false;
+    RequestedHosts.Add(HostAddress, &bAlreadyRequested);
+    if (bAlreadyRequested)
+    {
+        return;
+    }
+
+    QueuedHosts.Add(HostAddress);
+    PumpQueue();
+}
+
+void US_PingService::CancelPendingPings()
+{
+    for (int32 Index = QueueHead; Index < QueuedHosts.Num(); ++Index)
+    {
+        RequestedHosts.Remove(QueuedHosts[Index]);
+    }
+    QueuedHosts.Reset();
+    QueueHead = 0;
+}
+
+void US_PingService::PumpQueue()
+{
+    while (NumInFlight < FMath::Max(MaxPingsInFlight, 1) && QueueHead < QueuedHosts.Num())
+    {
+        StartProbe(QueuedHosts[QueueHead++]);
+    }
+
+    if (QueueHead == QueuedHosts.Num())
+    {
+        QueuedHosts.Reset();
+        QueueHead = 0;
+    }
+}
+
+void US_PingService::StartProbe(const FString& HostAddress)
+{
+    ++NumInFlight;
+    TWeakObjectPtr<US_PingService> WeakThis(this);
+
+    if (ProbeMode == E_PingProbeMode::Loopback)
+    {
+        // Stable per host, so cached and fresh values agree and sorting by ping is reproducible.
+        const int32 SimulatedPingMs = 5 + static_cast<int32>(GetTypeHash(HostAddress) % 195);
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis, HostAddress, SimulatedPingMs](float)
+        {
+            if (US_PingService* Service = WeakThis.Get())
+            {
+                Service->HandleProbeResult(HostAddress, SimulatedPingMs);
+            }
+            return false;
+        }), SimulatedPingMs / 1000.f);
+        return;
+    }
+
+    // The echo runs on a worker thread; the callback is delivered on the game thread.
+    FIcmp::IcmpEcho(HostAddress, PingTimeoutSeconds, [WeakThis, HostAddress](FIcmpEchoResult Result)
+    {
+        if (US_PingService* Service = WeakThis.Get())
+        {
+            Service->HandleProbeResult(HostAddress,
+                Result.Status == EIcmpResponseStatus::Success ? FMath::RoundToInt(Result.Time * 1000.f) : INDEX_NONE);
+        }
+    });
+}
+
+void US_PingService::HandleProbeResult(const FString& HostAddress, int32 PingMs)
+{
+    NumInFlight = FMath::Max(NumInFlight - 1, 0);
+    RequestedHosts.Remove(HostAddress);
+
+    if (PingMs != INDEX_NONE)
+    {
+        FCachedPing& Cached = PingCache.FindOrAdd(HostAddress);
+        Cached.PingMs = PingMs;
+        Cached.MeasuredAt = FDateTime::UtcNow().ToUnixTimestamp();
+        bCacheDirty = true;
+
+        OnPingMeasured.Broadcast(HostAddress, PingMs);
+    }
+
+    PumpQueue();
+
+    // Persist once a burst of probes has settled rather than after every answer.
+    if (bCacheDirty && NumInFlight == 0 && QueuedHosts.Num() == 0)
+    {
+        SaveCache();
+    }
+}
+
+void US_PingService::LoadCache()
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetCachePath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    int32 NumEntries = 0;
+    Reader << Magic;
+    Reader << NumEntries;
+    if (Reader.IsError() || Magic != PingServiceCache::Magic || NumEntries < 0 || NumEntries > PingServiceCache::MaxEntries)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("US_PingService: Ignoring unreadable ping cache %s."), *GetCachePath());
+        return;
+    }
+
+    // Expired entries are dropped here so the file doesn't grow with every server ever seen.
+    const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+    PingCache.Reserve(NumEntries);
+    for (int32 Index = 0; Index < NumEntries && !Reader.IsError(); ++Index)
+    {
+        FString HostAddress;
+        FCachedPing Cached;
+        Reader << HostAddress;
+        Reader << Cached.PingMs;
+        Reader << Cached.MeasuredAt;
+        if (!Reader.IsError() && Now - Cached.MeasuredAt <= PingCacheTTLSeconds)
+        {
+            PingCache.Add(MoveTemp(HostAddress), Cached);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("US_PingService: Loaded %d cached pings."), PingCache.Num());
+}
+
+void US_PingService::SaveCache()
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 Magic = PingServiceCache::Magic;
+    int32 NumEntries = PingCache.Num();
+    Writer << Magic;
+    Writer << NumEntries;
+    for (TPair<FString, FCachedPing>& Pair : PingCache)
+    {
+        Writer << Pair.Key;
+        Writer << Pair.Value.PingMs;
+        Writer << Pair.Value.MeasuredAt;
+    }
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *GetCachePath()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("US_PingService: Failed to write ping cache %s."), *GetCachePath());
+        return;
+    }
+    bCacheDirty = false;
+}
+
+FString US_PingService::GetCachePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("ServerBrowser") / TEXT("PingCache.bin");
+}
@@ -0,0 +1,290 @@
+// Plugins/StrafeUI/Source/StrafeUI/Private/Services/S_ReplayCatalog.cpp
+
+#include "Services/S_ReplayCatalog.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace ReplayCatalogFile
+{
+    /** "SRC1" - identifies the catalog file and its layout. */
+    constexpr uint32 Magic = 0x53524331;
+
+    /** Sanity limit so a corrupt count cannot trigger a huge allocation. */
+    constexpr int32 MaxEntries = 100000;
+
+    FArchive& SerializeReplayInfo(FArchive& Ar, FReplayInfo& Info)
+    {
+        Ar << Info.FileName;
+        Ar << Info.Timestamp;
+        Ar << Info.FileSizeKB;
+        Ar << Info.MapName;
+        Ar << Info.GameMode;
+        Ar << Info.DurationSeconds;
+        Ar << Info.NumPlayers;
+        return Ar;
+    }
+}
+
+void US_ReplayCatalog::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const double StartTime = FPlatformTime::Seconds();
+    LoadCatalog();
+
+    UE_LOG(LogTemp, Log, TEXT("US_ReplayCatalog: Loaded %d replays in %.1f ms."), Replays.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void US_ReplayCatalog::Deinitialize()
+{
+    RefreshPendingReplays();
+    PendingReplaySizes.Empty();
+    Replays.Empty();
+    Super::Deinitialize();
+}
+
+const TArray<FReplayInfo>& US_ReplayCatalog::GetReplays()
+{
+    if (HasDirectoryChanged())
+    {
+        Rescan();
+    }
+    RefreshPendingReplays();
+    return Replays;
+}
+
+const FReplayInfo* US_ReplayCatalog::FindReplay(const FString& ReplayName) const
+{
+    return Replays.FindByPredicate([&ReplayName](const FReplayInfo& Info) { return Info.FileName == ReplayName; });
+}
+
+void US_ReplayCatalog::AddReplay(FReplayInfo Info)
+{
+    if (Info.FileName.IsEmpty())
+    {
+        return;
+    }
+
+    if (Info.FileSizeKB <= 0)
+    {
+        const FFileStatData FileData = IFileManager::Get().GetStatData(*FPaths::Combine(GetReplayDirectory(), Info.FileName + TEXT(".replay")));
+        if (FileData.bIsValid)
+        {
+            Info.FileSizeKB = FMath::DivideAndRoundUp(FileData.FileSize, (int64)1024);
+            Info.Timestamp = FileData.ModificationTime;
+        }
+    }
+
+    if (FReplayInfo* Existing = Replays.FindByPredicate([&Info](const FReplayInfo& Other) { return Other.FileName == Info.FileName; }))
+    {
+        *Existing = MoveTemp(Info);
+    }
+    else
+    {
+        Replays.Add(MoveTemp(Info));
+    }
+    SortReplays();
+    SaveCatalog();
+}
+
+void US_ReplayCatalog::AddPendingReplay(FReplayInfo Info)
+{
+    if (Info.FileName.IsEmpty())
+    {
+        return;
+    }
+
+    PendingReplaySizes.Add(Info.FileName, -1);
+    AddReplay(MoveTemp(Info));
+}
+
+void US_ReplayCatalog::RemoveReplay(const FString& ReplayName)
+{
+    PendingReplaySizes.Remove(ReplayName);
+    if (Replays.RemoveAll([&ReplayName](const FReplayInfo& Info) { return Info.FileName == ReplayName; }) > 0)
+    {
+        SaveCatalog();
+    }
+}
+
+FString US_ReplayCatalog::GetReplayDirectory()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Demos"));
+}
+
+bool US_ReplayCatalog::HasDirectoryChanged() const
+{
+    const FFileStatData DirectoryData = IFileManager::Get().GetStatData(*GetReplayDirectory());
+    return DirectoryData.bIsValid ? DirectoryData.ModificationTime != DirectoryTimestamp : Replays.Num() > 0;
+}
+
+void US_ReplayCatalog::Rescan()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const FString ReplayDir = GetReplayDirectory();
+    IFileManager& FileManager = IFileManager::Get();
+
+    TArray<FString> ReplayFiles;
+    FileManager.FindFiles(ReplayFiles, *ReplayDir, TEXT("*.replay"));
+
+    TSet<FString> OnDisk;
+    OnDisk.Reserve(ReplayFiles.Num());
+    for (const FString& FileName : ReplayFiles)
+    {
+        OnDisk.Add(FPaths::GetBaseFilename(FileName));
+    }
+
+    // Drop what's gone, then stat only what's new.
+    const int32 NumRemoved = Replays.RemoveAll([&OnDisk](const FReplayInfo& Info) { return !OnDisk.Contains(Info.FileName); });
+    for (const FReplayInfo& Info : Replays)
+    {
+        OnDisk.Remove(Info.FileName);
+    }
+
+    for (const FString& ReplayName : OnDisk)
+    {
+        const FFileStatData FileData = FileManager.GetStatData(*FPaths::Combine(ReplayDir, ReplayName + TEXT(".replay")));
+
+        FReplayInfo& Info = Replays.AddDefaulted_GetRef();
+        Info.FileName = ReplayName;
+        Info.Timestamp = FileData.ModificationTime;
+        Info.FileSizeKB = FMath::DivideAndRoundUp(FileData.FileSize, (int64)1024);
+    }
+
+    SortReplays();
+    SaveCatalog();
+
+    UE_LOG(LogTemp, Log, TEXT("US_ReplayCatalog: Rescanned %s (%d added, %d removed) in %.1f ms."),
+        *ReplayDir, OnDisk.Num(), NumRemoved, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void US_ReplayCatalog::RefreshPendingReplays()
+{
+    if (PendingReplaySizes.Num() == 0)
+    {
+        return;
+    }
+
+    bool bChanged = false;
+    for (auto It = PendingReplaySizes.CreateIterator(); It; ++It)
+    {
+        FReplayInfo* Info = Replays.FindByPredicate([&It](const FReplayInfo& Other) { return Other.FileName == It->Key; });
+        if (!Info)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        const FFileStatData FileData = IFileManager::Get().GetStatData(*FPaths::Combine(GetReplayDirectory(), Info->FileName + TEXT(".replay")));
+        if (!FileData.bIsValid)
+        {
+            continue;
+        }
+        if (FileData.FileSize == It->Value)
+        {
+            // Unchanged since the last look; the streamer is done with it.
+            It.RemoveCurrent();
+            continue;
+        }
+
+        It->Value = FileData.FileSize;
+        Info->FileSizeKB = FMath::DivideAndRoundUp(FileData.FileSize, (int64)1024);
+        Info->Timestamp = FileData.ModificationTime;
+        bChanged = true;
+    }
+
+    if (bChanged)
+    {
+        SortReplays();
+        SaveCatalog();
+    }
+}
+
+void US_ReplayCatalog::SortReplays()
+{
+    // Sort by timestamp (newest first)
+    Replays.Sort([](const FReplayInfo& A, const FReplayInfo& B)
+        {
+            return A.Timestamp > B.Timestamp;
+        });
+}
+
+void US_ReplayCatalog::LoadCatalog()
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetCatalogPath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    int32 NumEntries = 0;
+    Reader << Magic;
+    Reader << DirectoryTimestamp;
+    Reader << NumEntries;
+    if (Reader.IsError() || Magic != ReplayCatalogFile::Magic || NumEntries < 0 || NumEntries > ReplayCatalogFile::MaxEntries)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("US_ReplayCatalog: %s is unreadable. It will be rebuilt from the replay directory."), *GetCatalogPath());
+        DirectoryTimestamp = FDateTime();
+        return;
+    }
+
+    Replays.SetNum(NumEntries);
+    for (FReplayInfo& Info : Replays)
+    {
+        ReplayCatalogFile::SerializeReplayInfo(Reader, Info);
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("US_ReplayCatalog: %s is truncated. It will be rebuilt from the replay directory."), *GetCatalogPath());
+        Replays.Reset();
+        DirectoryTimestamp = FDateTime();
+    }
+}
+
+void US_ReplayCatalog::SaveCatalog()
+{
+    IFileManager& FileManager = IFileManager::Get();
+    FileManager.MakeDirectory(*GetReplayDirectory(), true);
+
+    // Writing the catalog inside the directory bumps its timestamp, so write once, then record the timestamp
+    // that results and write again. The second write replaces an existing file and leaves the directory alone.
+    for (int32 Pass = 0; Pass < 2; ++Pass)
+    {
+        const FFileStatData DirectoryData = FileManager.GetStatData(*GetReplayDirectory());
+        DirectoryTimestamp = DirectoryData.bIsValid ? DirectoryData.ModificationTime : FDateTime();
+
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        uint32 Magic = ReplayCatalogFile::Magic;
+        int32 NumEntries = Replays.Num();
+        Writer << Magic;
+        Writer << DirectoryTimestamp;
+        Writer << NumEntries;
+        for (FReplayInfo& Info : Replays)
+        {
+            ReplayCatalogFile::SerializeReplayInfo(Writer, Info);
+        }
+
+        if (!FFileHelper::SaveArrayToFile(Bytes, *GetCatalogPath()))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("US_ReplayCatalog: Failed to write %s."), *GetCatalogPath());
+            return;
+        }
+
+        if (FileManager.GetStatData(*GetReplayDirectory()).ModificationTime == DirectoryTimestamp)
+        {
+            return;
+        }
+    }
+}
+
+FString US_ReplayCatalog::GetCatalogPath()
+{
+    return FPaths::Combine(GetReplayDirectory(), TEXT("ReplayCatalog.bin"));
+}
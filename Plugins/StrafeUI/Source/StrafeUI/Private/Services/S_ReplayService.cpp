@@ -1,12 +1,18 @@
 // Plugins/StrafeUI/Source/StrafeUI/Private/Services/S_ReplayService.cpp
 
 #include "Services/S_ReplayService.h"
+#include "Services/S_ReplayCatalog.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/FileManager.h"
 #include "Misc/Paths.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "TimerManager.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameStateBase.h"
+#include "Engine/DemoNetDriver.h"
+#include "HAL/IConsoleManager.h"
+#include "StrafeReplayStreaming.h"
 
 void US_ReplayService::FindLocalReplays(TFunction<void(TArray<FReplayInfo>)> OnComplete)
 {
@@ -15,70 +21,195 @@ void US_ReplayService::FindLocalReplays(TFunction<void(TArray<FReplayInfo>)> OnC
         return;
     }
 
-    // Cancel any existing timer
-    if (AsyncOperationTimer.IsValid())
+    // The catalog is in memory and already sorted newest first; one directory stat is all the I/O this costs.
+    if (US_ReplayCatalog* Catalog = GetCatalog())
     {
-        if (UWorld* World = GetWorld())
-        {
-            World->GetTimerManager().ClearTimer(AsyncOperationTimer);
-        }
+        OnComplete(Catalog->GetReplays());
+        return;
     }
+    OnComplete(TArray<FReplayInfo>());
+}
 
-    // Simulate async operation
-    if (UWorld* World = GetWorld())
+void US_ReplayService::RegisterRecordedReplay(const FReplayInfo& Info)
+{
+    if (US_ReplayCatalog* Catalog = GetCatalog())
     {
-        World->GetTimerManager().SetTimer(AsyncOperationTimer,
-            [this, OnComplete]()
-            {
-                TArray<FReplayInfo> Replays;
+        Catalog->AddPendingReplay(Info);
+    }
+}
 
-                FString ReplayDir = GetReplayDirectory();
-                IFileManager& FileManager = IFileManager::Get();
+void US_ReplayService::PlayReplay(const FString& ReplayName, APlayerController* PC)
+{
+    if (!PC)
+    {
+        UE_LOG(LogTemp, Error, TEXT("PlayReplay: Invalid PlayerController"));
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Playing replay: %s"), *ReplayName);
 
-                // Find all .replay files
-                TArray<FString> ReplayFiles;
-                FileManager.FindFiles(ReplayFiles, *ReplayDir, TEXT("*.replay"));
+    // Play through the compressing streamer; it reads uncompressed replays as well
+    if (UGameInstance* GameInstance = PC->GetGameInstance())
+    {
+        GameInstance->PlayReplay(ReplayName, nullptr, MakeStreamerOptions(true));
+    }
+}
 
-                for (const FString& FileName : ReplayFiles)
-                {
-                    FString FullPath = FPaths::Combine(ReplayDir, FileName);
+bool US_ReplayService::StartRecording(const FString& ReplayName, const FReplayRecordingSettings& Settings)
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    if (!GameInstance || ReplayName.IsEmpty() || !RecordingReplayName.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StartRecording: Cannot record %s"), *ReplayName);
+        return false;
+    }
 
-                    FReplayInfo Info;
-                    Info.FileName = FPaths::GetBaseFilename(FileName);
+    // Checkpoints are taken by the demo driver at this interval for the whole recording; StopRecording restores it
+    if (IConsoleVariable* CheckpointDelay = IConsoleManager::Get().FindConsoleVariable(TEXT("demo.CheckpointUploadDelayInSeconds")))
+    {
+        SavedCheckpointUploadDelay = CheckpointDelay->GetFloat();
+        bCheckpointUploadDelayOverridden = true;
+        CheckpointDelay->Set(FMath::Max(Settings.CheckpointIntervalSeconds, 1.0f), ECVF_SetByCode);
+    }
 
-                    // Get file info
-                    FFileStatData FileData = FileManager.GetStatData(*FullPath);
-                    Info.Timestamp = FileData.ModificationTime;
-                    Info.FileSizeKB = FMath::DivideAndRoundUp(FileData.FileSize, (int64)1024);
+    GameInstance->StartRecordingReplay(ReplayName, ReplayName, MakeStreamerOptions(Settings.bCompress));
+    RecordingReplayName = ReplayName;
 
-                    Replays.Add(Info);
-                }
+    UE_LOG(LogTemp, Log, TEXT("Recording replay %s (checkpoint every %.1fs, %s)"), *ReplayName,
+        Settings.CheckpointIntervalSeconds, Settings.bCompress ? TEXT("compressed") : TEXT("uncompressed"));
+    return true;
+}
 
-                // Sort by timestamp (newest first)
-                Replays.Sort([](const FReplayInfo& A, const FReplayInfo& B)
-                    {
-                        return A.Timestamp > B.Timestamp;
-                    });
+void US_ReplayService::StopRecording()
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    if (!GameInstance || RecordingReplayName.IsEmpty())
+    {
+        return;
+    }
 
-                OnComplete(Replays);
-            },
-            0.1f, false);
+    // Gather what only the running match knows before the recording goes away
+    FReplayInfo Info;
+    Info.FileName = RecordingReplayName;
+    Info.MapName = World->GetMapName();
+    Info.MapName.RemoveFromStart(World->StreamingLevelsPrefix);
+    if (const AGameStateBase* GameState = World->GetGameState())
+    {
+        Info.GameMode = GameState->GameModeClass ? GameState->GameModeClass->GetName() : FString();
+        Info.NumPlayers = GameState->PlayerArray.Num();
+    }
+    if (const UDemoNetDriver* DemoDriver = World->GetDemoNetDriver())
+    {
+        Info.DurationSeconds = DemoDriver->GetDemoCurrentTime();
+    }
+
+    GameInstance->StopRecordingReplay();
+    RecordingReplayName.Reset();
+
+    if (bCheckpointUploadDelayOverridden)
+    {
+        if (IConsoleVariable* CheckpointDelay = IConsoleManager::Get().FindConsoleVariable(TEXT("demo.CheckpointUploadDelayInSeconds")))
+        {
+            CheckpointDelay->Set(SavedCheckpointUploadDelay, ECVF_SetByCode);
+        }
+        bCheckpointUploadDelayOverridden = false;
     }
+
+    RegisterRecordedReplay(Info);
 }
 
-void US_ReplayService::PlayReplay(const FString& ReplayName, APlayerController* PC)
+bool US_ReplayService::SeekReplay(float TimeSeconds, TFunction<void(bool)> OnComplete)
 {
-    if (!PC)
+    if (!GetPlayingDemoDriver())
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayReplay: Invalid PlayerController"));
+        return false;
+    }
+
+    // Replace any seek still waiting; only the latest target (and callback) matters
+    PendingSeekTime = TimeSeconds;
+    PendingSeekCallback = MoveTemp(OnComplete);
+    bHasPendingSeek = true;
+
+    if (!bSeekInProgress)
+    {
+        RunPendingSeek();
+    }
+    return true;
+}
+
+void US_ReplayService::RunPendingSeek()
+{
+    UDemoNetDriver* DemoDriver = GetPlayingDemoDriver();
+    if (!DemoDriver)
+    {
+        bHasPendingSeek = false;
+        if (TFunction<void(bool)> Callback = MoveTemp(PendingSeekCallback))
+        {
+            Callback(false);
+        }
         return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Playing replay: %s"), *ReplayName);
+    const float TargetTime = FMath::Clamp(PendingSeekTime, 0.0f, DemoDriver->GetDemoTotalTime());
+    TFunction<void(bool)> Callback = MoveTemp(PendingSeekCallback);
+    PendingSeekCallback = nullptr;
+    bHasPendingSeek = false;
+    bSeekInProgress = true;
+
+    TWeakObjectPtr<US_ReplayService> WeakThis(this);
+    DemoDriver->GotoTimeInSeconds(TargetTime, FOnGotoTimeDelegate::CreateLambda(
+        [WeakThis, Callback = MoveTemp(Callback)](const bool bWasSuccessful)
+        {
+            if (Callback)
+            {
+                Callback(bWasSuccessful);
+            }
+
+            if (US_ReplayService* Service = WeakThis.Get())
+            {
+                Service->bSeekInProgress = false;
+                if (Service->bHasPendingSeek)
+                {
+                    Service->RunPendingSeek();
+                }
+            }
+        }));
+}
+
+float US_ReplayService::GetReplayCurrentTime() const
+{
+    const UDemoNetDriver* DemoDriver = GetPlayingDemoDriver();
+    return DemoDriver ? DemoDriver->GetDemoCurrentTime() : 0.0f;
+}
+
+float US_ReplayService::GetReplayTotalTime() const
+{
+    const UDemoNetDriver* DemoDriver = GetPlayingDemoDriver();
+    return DemoDriver ? DemoDriver->GetDemoTotalTime() : 0.0f;
+}
+
+bool US_ReplayService::IsPlayingReplay() const
+{
+    return GetPlayingDemoDriver() != nullptr;
+}
+
+UDemoNetDriver* US_ReplayService::GetPlayingDemoDriver() const
+{
+    UWorld* World = GetWorld();
+    UDemoNetDriver* DemoDriver = World ? World->GetDemoNetDriver() : nullptr;
+    return DemoDriver && DemoDriver->IsPlaying() ? DemoDriver : nullptr;
+}
 
-    // Start playing the replay via console command
-    FString Command = FString::Printf(TEXT("demoplay %s"), *ReplayName);
-    PC->ConsoleCommand(Command);
+TArray<FString> US_ReplayService::MakeStreamerOptions(bool bCompress)
+{
+    TArray<FString> Options;
+    if (bCompress)
+    {
+        Options.Add(FString::Printf(TEXT("ReplayStreamerOverride=%s"), FStrafeReplayStreamingModule::GetStreamerName()));
+    }
+    return Options;
 }
 
 void US_ReplayService::DeleteReplay(const FString& ReplayName, TFunction<void(bool)> OnComplete)
@@ -111,6 +242,11 @@ void US_ReplayService::DeleteReplay(const FString& ReplayName, TFunction<void(bo
                 if (bSuccess)
                 {
                     UE_LOG(LogTemp, Log, TEXT("Successfully deleted replay: %s"), *ReplayName);
+
+                    if (US_ReplayCatalog* Catalog = GetCatalog())
+                    {
+                        Catalog->RemoveReplay(ReplayName);
+                    }
                 }
                 else
                 {
@@ -125,5 +261,12 @@ void US_ReplayService::DeleteReplay(const FString& ReplayName, TFunction<void(bo
 
 FString US_ReplayService::GetReplayDirectory() const
 {
-    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Demos"));
+    return US_ReplayCatalog::GetReplayDirectory();
+}
+
+US_ReplayCatalog* US_ReplayService::GetCatalog() const
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<US_ReplayCatalog>() : nullptr;
 }
\ No newline at end of file
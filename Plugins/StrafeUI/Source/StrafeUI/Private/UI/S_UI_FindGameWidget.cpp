@@ -24,6 +24,7 @@ void US_UI_FindGameWidget::SetViewModel(US_UI_ViewModelBase* InViewModel)
 
         // Bind to the ViewModel's OnDataChanged delegate to be notified of updates.
         ViewModel->OnDataChanged.AddUniqueDynamic(this, &US_UI_FindGameWidget::OnServerListUpdated);
+        ViewModel->OnEntriesAppended.AddUObject(this, &US_UI_FindGameWidget::OnServerEntriesAppended);
 
         // Bind the refresh button click now that the ViewModel is valid.
         if (Btn_Refresh)
@@ -33,8 +34,7 @@ void US_UI_FindGameWidget::SetViewModel(US_UI_ViewModelBase* InViewModel)
             Btn_Refresh->OnClicked().AddUObject(ViewModel.Get(), &US_UI_VM_ServerBrowser::RequestServerListRefresh);
         }
 
-        // Trigger an initial server list refresh when the screen is opened.
-        ViewModel->RequestServerListRefresh();
+        // No search here: the navigator may build this screen in the background. It refreshes when the screen is shown.
     }
 }
 
@@ -78,44 +78,16 @@ void US_UI_FindGameWidget::OnServerListUpdated()
 {
     if (ViewModel.IsValid() && List_Servers)
     {
-        // Store the currently selected item before clearing
+        // The list view is virtualized: it only creates (pooled) row widgets for the visible entries,
+        // so handing it the view model's entry objects directly is cheap even for thousands of servers.
         US_UI_VM_ServerListEntry* PreviouslySelected = List_Servers->GetSelectedItem<US_UI_VM_ServerListEntry>();
-        FString PreviousServerName;
-        if (PreviouslySelected)
-        {
-            PreviousServerName = PreviouslySelected->ServerInfo.ServerName.ToString();
-        }
 
-        List_Servers->ClearListItems();
+        List_Servers->SetListItems(ViewModel->GetFilteredEntries());
 
-        // Populate the list view with data from the ViewModel.
-        for (const F_ServerInfo& ServerInfo : ViewModel->ServerList)
+        // Filtering keeps the same entry objects, so the selection survives if it is still shown
+        if (PreviouslySelected && List_Servers->GetIndexForItem(PreviouslySelected) != INDEX_NONE)
         {
-            // Create a UObject wrapper for our list entry data
-            US_UI_VM_ServerListEntry* Entry = NewObject<US_UI_VM_ServerListEntry>(this);
-            Entry->ServerInfo = ServerInfo;
-
-            // Find the corresponding full search result from the ViewModel's internal list
-            // This is needed for the join functionality
-            for (const auto& FoundServer : ViewModel->AllFoundServers)
-            {
-                if (FoundServer &&
-                    FoundServer->ServerInfo.ServerName.EqualTo(ServerInfo.ServerName) &&
-                    FoundServer->ServerInfo.Ping == ServerInfo.Ping)
-                {
-                    Entry->SessionSearchResult = FoundServer->SessionSearchResult;
-                    break;
-                }
-            }
-
-            // Add the data object to the list view. The list view will create a widget for it.
-            List_Servers->AddItem(Entry);
-
-            // Try to restore selection if this was the previously selected server
-            if (!PreviousServerName.IsEmpty() && Entry->ServerInfo.ServerName.ToString() == PreviousServerName)
-            {
-                List_Servers->SetSelectedItem(Entry);
-            }
+            List_Servers->SetSelectedItem(PreviouslySelected);
         }
 
         // Update button states
@@ -123,6 +95,20 @@ void US_UI_FindGameWidget::OnServerListUpdated()
     }
 }
 
+void US_UI_FindGameWidget::OnServerEntriesAppended(int32 FirstFilteredIndex, int32 Count)
+{
+    if (!ViewModel.IsValid() || !List_Servers)
+    {
+        return;
+    }
+
+    const TArray<TObjectPtr<US_UI_VM_ServerListEntry>>& Entries = ViewModel->GetFilteredEntries();
+    for (int32 Index = FirstFilteredIndex; Index < FirstFilteredIndex + Count && Index < Entries.Num(); ++Index)
+    {
+        List_Servers->AddItem(Entries[Index]);
+    }
+}
+
 void US_UI_FindGameWidget::OnServerSelected(UObject* Item)
 {
     // The only thing we need to do when selection changes is update the button states.
@@ -217,7 +203,7 @@ void US_UI_FindGameWidget::OnFiltersChanged()
     ViewModel->bFilterHidePrivateServers = ServerFilterWidget->GetHidePrivateServers();
     ViewModel->FilterMaxPing = ServerFilterWidget->GetMaxPing();
 
-    // Apply the filters
+    // Apply the filters; debounced in the view model since this fires on every keystroke
     ViewModel->ApplyFilters();
 }
 
@@ -43,7 +43,7 @@ void US_UI_LeaderboardEntryWidget::NativeOnListItemObjectSet(UObject* ListItemOb
         // Update time
         if (Text_Time)
         {
-            Text_Time->SetText(FText::FromString(Entry->FormattedTime));
+            Text_Time->SetText(FText::FromString(Entry->GetFormattedTime()));
         }
 
         // Update rank icon if present (for medals)
@@ -71,11 +71,8 @@ void US_UI_LeaderboardEntryWidget::NativeOnListItemObjectSet(UObject* ListItemOb
             {
                 if (US_UI_LeaderboardsWidget* LeaderboardWidget = Cast<US_UI_LeaderboardsWidget>(ParentWidget))
                 {
-                    // Access the view model through the CreateViewModel function
-                    if (US_UI_ViewModelBase* BaseVM = LeaderboardWidget->CreateViewModel())
-                    {
-                        ParentViewModel = Cast<US_UI_VM_Leaderboards>(BaseVM);
-                    }
+                    // Use the screen's existing view model; creating one here would re-fetch the board for every row
+                    ParentViewModel = LeaderboardWidget->GetViewModel();
                     break;
                 }
                 ParentWidget = ParentWidget->GetParent();
@@ -24,12 +24,19 @@ void US_UI_LeaderboardsWidget::SetViewModel(US_UI_ViewModelBase* InViewModel)
 
         // Bind to data changes
         ViewModel->OnDataChanged.AddUniqueDynamic(this, &US_UI_LeaderboardsWidget::OnViewModelDataChanged);
+        ViewModel->OnWindowShifted.AddUObject(this, &US_UI_LeaderboardsWidget::OnWindowShifted);
+        ViewModel->OnWindowReset.AddUObject(this, &US_UI_LeaderboardsWidget::OnWindowReset);
 
         // Initial update
         OnViewModelDataChanged();
     }
 }
 
+US_UI_VM_Leaderboards* US_UI_LeaderboardsWidget::GetViewModel() const
+{
+    return ViewModel.Get();
+}
+
 void US_UI_LeaderboardsWidget::NativeOnInitialized()
 {
     Super::NativeOnInitialized();
@@ -50,6 +57,17 @@ void US_UI_LeaderboardsWidget::NativeOnInitialized()
     {
         Btn_Back->OnClicked().AddUObject(this, &US_UI_LeaderboardsWidget::OnBackClicked);
     }
+
+    if (Btn_FindMe)
+    {
+        Btn_FindMe->OnClicked().AddUObject(this, &US_UI_LeaderboardsWidget::OnFindMeClicked);
+    }
+
+    // The list view only builds rows for what is on screen; page the data in as it scrolls
+    if (ListView_Leaderboard)
+    {
+        ListView_Leaderboard->BP_OnListViewScrolled.AddDynamic(this, &US_UI_LeaderboardsWidget::OnLeaderboardScrolled);
+    }
 }
 
 void US_UI_LeaderboardsWidget::OnViewModelDataChanged()
@@ -85,14 +103,53 @@ void US_UI_LeaderboardsWidget::OnViewModelDataChanged()
         Throbber_Loading->SetVisibility(ViewModel->bIsLoading ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
     }
 
-    // Update leaderboard list
+    // Update leaderboard list. Only the visible rows are regenerated; the scroll position is kept.
     if (ListView_Leaderboard)
     {
-        ListView_Leaderboard->ClearListItems();
-        for (UObject* Entry : ViewModel->LeaderboardEntries)
-        {
-            ListView_Leaderboard->AddItem(Entry);
-        }
+        ListView_Leaderboard->SetListItems(ViewModel->LeaderboardEntries);
+    }
+}
+
+void US_UI_LeaderboardsWidget::OnLeaderboardScrolled(float ItemOffset, float DistanceRemaining)
+{
+    if (!ViewModel.IsValid() || !ListView_Leaderboard)
+    {
+        return;
+    }
+
+    const int32 NumVisibleRows = ListView_Leaderboard->GetDisplayedEntryWidgets().Num();
+    if (ItemOffset + NumVisibleRows >= ViewModel->LeaderboardEntries.Num() - PageLoadThresholdRows)
+    {
+        ViewModel->LoadNextPage();
+    }
+    else if (ItemOffset <= PageLoadThresholdRows)
+    {
+        ViewModel->LoadPreviousPage();
+    }
+}
+
+void US_UI_LeaderboardsWidget::OnWindowShifted(int32 RowsAddedAtFront)
+{
+    if (ListView_Leaderboard)
+    {
+        ListView_Leaderboard->SetScrollOffset(FMath::Max(0.f, ListView_Leaderboard->GetScrollOffset() + RowsAddedAtFront));
+    }
+}
+
+void US_UI_LeaderboardsWidget::OnWindowReset(int32 FocusIndex)
+{
+    if (!ListView_Leaderboard)
+    {
+        return;
+    }
+
+    if (FocusIndex > 0)
+    {
+        ListView_Leaderboard->ScrollIndexIntoView(FocusIndex);
+    }
+    else
+    {
+        ListView_Leaderboard->SetScrollOffset(0.f);
     }
 }
 
@@ -112,6 +169,14 @@ void US_UI_LeaderboardsWidget::OnRefreshClicked()
     }
 }
 
+void US_UI_LeaderboardsWidget::OnFindMeClicked()
+{
+    if (ViewModel.IsValid())
+    {
+        ViewModel->ShowAroundLocalPlayer();
+    }
+}
+
 void US_UI_LeaderboardsWidget::OnBackClicked()
 {
     if (US_UI_Subsystem* UISubsystem = GetUISubsystem())
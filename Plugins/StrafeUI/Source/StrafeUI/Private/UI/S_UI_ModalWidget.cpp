@@ -60,12 +60,14 @@ void US_UI_ModalWidget::NativeOnInitialized()
 
 void US_UI_ModalWidget::HandleConfirmClicked()
 {
-	OnDismissed.Broadcast(true);
+	// Leave the viewport first: a listener may show this same widget again for the next queued modal.
 	RemoveFromParent();
+	OnDismissed.Broadcast(true);
 }
 
 void US_UI_ModalWidget::HandleDeclineClicked()
 {
-	OnDismissed.Broadcast(false);
+	// Leave the viewport first: a listener may show this same widget again for the next queued modal.
 	RemoveFromParent();
+	OnDismissed.Broadcast(false);
 }
\ No newline at end of file
@@ -23,9 +23,13 @@ void US_UI_ServerListEntry::NativePreConstruct()
 
 void US_UI_ServerListEntry::NativeOnListItemObjectSet(UObject* ListItemObject)
 {
+    // Rows are recycled by the list view; drop the previous entry before taking the new one
+    UnbindServerData();
+
     if (US_UI_VM_ServerListEntry* ServerEntry = Cast<US_UI_VM_ServerListEntry>(ListItemObject))
     {
         CachedServerData = ServerEntry;
+        PingUpdatedHandle = ServerEntry->OnPingUpdated.AddUObject(this, &US_UI_ServerListEntry::UpdatePingVisuals);
         const F_ServerInfo& ServerInfo = ServerEntry->ServerInfo;
 
         // Update server name
@@ -69,21 +73,7 @@ void US_UI_ServerListEntry::NativeOnListItemObjectSet(UObject* ListItemObject)
         }
 
         // Update ping
-        if (Txt_Ping)
-        {
-            Txt_Ping->SetText(FText::AsNumber(ServerInfo.Ping));
-
-            // Set color based on ping quality
-            FLinearColor PingColor = GetPingColor(ServerInfo.Ping);
-            Txt_Ping->SetColorAndOpacity(FSlateColor(PingColor));
-        }
-
-        // Update ping icon color
-        if (Img_PingIcon)
-        {
-            FLinearColor PingColor = GetPingColor(ServerInfo.Ping);
-            Img_PingIcon->SetColorAndOpacity(PingColor);
-        }
+        UpdatePingVisuals();
 
         // Show/hide private icon
         if (Img_PrivateIcon)
@@ -103,6 +93,46 @@ void US_UI_ServerListEntry::NativeOnListItemObjectSet(UObject* ListItemObject)
     }
 }
 
+void US_UI_ServerListEntry::NativeOnEntryReleased()
+{
+    UnbindServerData();
+    IUserObjectListEntry::NativeOnEntryReleased();
+}
+
+void US_UI_ServerListEntry::UnbindServerData()
+{
+    if (CachedServerData.IsValid())
+    {
+        CachedServerData->OnPingUpdated.Remove(PingUpdatedHandle);
+    }
+    PingUpdatedHandle.Reset();
+    CachedServerData.Reset();
+}
+
+void US_UI_ServerListEntry::UpdatePingVisuals()
+{
+    if (!CachedServerData.IsValid())
+    {
+        return;
+    }
+
+    const int32 Ping = CachedServerData->ServerInfo.Ping;
+
+    if (Txt_Ping)
+    {
+        Txt_Ping->SetText(FText::AsNumber(Ping));
+
+        // Set color based on ping quality
+        Txt_Ping->SetColorAndOpacity(FSlateColor(GetPingColor(Ping)));
+    }
+
+    // Update ping icon color
+    if (Img_PingIcon)
+    {
+        Img_PingIcon->SetColorAndOpacity(GetPingColor(Ping));
+    }
+}
+
 void US_UI_ServerListEntry::UpdateServerStatusVisuals()
 {
     if (!CachedServerData.IsValid())
@@ -2,23 +2,36 @@
 
 #include "ViewModel/S_UI_VM_Leaderboards.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+
+FString US_UI_VM_LeaderboardEntry::GetFormattedTime() const
+{
+    if (!bFormattedTimeValid)
+    {
+        FormattedTime = FormatTime(Time);
+        bFormattedTimeValid = true;
+    }
+    return FormattedTime;
+}
+
+void US_UI_VM_LeaderboardEntry::SetFromEntry(const FLeaderboardEntry& Entry)
+{
+    Rank = Entry.Rank;
+    PlayerName = Entry.PlayerName;
+    MapName = Entry.MapName;
+    Time = Entry.Time;
+    RecordId = Entry.RecordId;
+    bFormattedTimeValid = false;
+}
 
 void US_UI_VM_Leaderboards::Initialize()
 {
     // Create the leaderboard service
     LeaderboardService = NewObject<US_LeaderboardService>(this);
 
-    // Get available map names
-    MapNames = LeaderboardService->GetAvailableMapNames();
-
-    // Set initial map selection
-    if (MapNames.Num() > 0)
-    {
-        CurrentMapName = MapNames[0];
-        RefreshLeaderboard();
-    }
-
-    BroadcastDataChanged();
+    // Picks up the available map names and selects the first board
+    RefreshLeaderboard();
 }
 
 void US_UI_VM_Leaderboards::SetMapFilter(const FString& NewMapName)
@@ -32,8 +45,22 @@ void US_UI_VM_Leaderboards::SetMapFilter(const FString& NewMapName)
 
 void US_UI_VM_Leaderboards::RefreshLeaderboard()
 {
-    if (!LeaderboardService || CurrentMapName.IsEmpty())
+    if (!LeaderboardService)
+    {
+        return;
+    }
+
+    // Boards appear as maps are first finished; keep the selection unless its board is gone.
+    MapNames = LeaderboardService->GetAvailableMapNames();
+    if (!MapNames.Contains(CurrentMapName))
     {
+        CurrentMapName = MapNames.Num() > 0 ? MapNames[0] : FString();
+    }
+    if (CurrentMapName.IsEmpty())
+    {
+        ReleaseWindow();
+        TotalEntries = 0;
+        BroadcastDataChanged();
         return;
     }
 
@@ -41,33 +68,169 @@ void US_UI_VM_Leaderboards::RefreshLeaderboard()
     bIsLoading = true;
     BroadcastDataChanged();
 
-    // Clear existing entries
-    LeaderboardEntries.Empty();
+    // Fetch the first page only; the rest is loaded as the list scrolls
+    LeaderboardService->FetchLeaderboardPage(CurrentMapName, 1, PageSize,
+        [this](FLeaderboardPage Page)
+        {
+            ShowPage(MoveTemp(Page));
+        });
+}
+
+void US_UI_VM_Leaderboards::ShowAroundLocalPlayer()
+{
+    if (!LeaderboardService || CurrentMapName.IsEmpty())
+    {
+        return;
+    }
+
+    bIsLoading = true;
+    BroadcastDataChanged();
 
-    // Fetch new data
-    LeaderboardService->FetchLeaderboardData(CurrentMapName,
-        [this](TArray<FLeaderboardEntry> Entries)
+    LeaderboardService->FetchLeaderboardAroundPlayer(CurrentMapName, GetLocalPlayerId(), PageSize,
+        [this](FLeaderboardPage Page)
         {
-            // Convert raw entries to view model entries
-            LeaderboardEntries.Empty();
+            ShowPage(MoveTemp(Page));
+        });
+}
+
+bool US_UI_VM_Leaderboards::LoadNextPage()
+{
+    if (!LeaderboardService || bIsLoading || !HasNextPage())
+    {
+        return false;
+    }
 
-            int32 Rank = 1;
-            for (const FLeaderboardEntry& Entry : Entries)
+    bIsLoading = true;
+    LeaderboardService->FetchLeaderboardPage(CurrentMapName, WindowFirstRank + LeaderboardEntries.Num(), PageSize,
+        [this](FLeaderboardPage Page)
+        {
+            TotalEntries = Page.TotalEntries;
+            LeaderboardEntries.Reserve(LeaderboardEntries.Num() + Page.Entries.Num());
+            for (const FLeaderboardEntry& Entry : Page.Entries)
             {
-                US_UI_VM_LeaderboardEntry* VMEntry = NewObject<US_UI_VM_LeaderboardEntry>(this);
-                VMEntry->Rank = Rank++;
-                VMEntry->PlayerName = Entry.PlayerName;
-                VMEntry->MapName = Entry.MapName;
-                VMEntry->Time = Entry.Time;
-                VMEntry->FormattedTime = FormatTime(Entry.Time);
-
-                LeaderboardEntries.Add(VMEntry);
+                LeaderboardEntries.Add(AcquireEntry(Entry));
             }
+            const int32 NumReleased = TrimWindow(true);
 
-            // Update loading state
             bIsLoading = false;
             BroadcastDataChanged();
+            if (NumReleased > 0)
+            {
+                OnWindowShifted.Broadcast(-NumReleased);
+            }
         });
+    return true;
+}
+
+bool US_UI_VM_Leaderboards::LoadPreviousPage()
+{
+    if (!LeaderboardService || bIsLoading || !HasPreviousPage())
+    {
+        return false;
+    }
+
+    const int32 FirstRank = FMath::Max(WindowFirstRank - PageSize, 1);
+    bIsLoading = true;
+    LeaderboardService->FetchLeaderboardPage(CurrentMapName, FirstRank, WindowFirstRank - FirstRank,
+        [this](FLeaderboardPage Page)
+        {
+            TotalEntries = Page.TotalEntries;
+
+            TArray<UObject*> NewEntries;
+            NewEntries.Reserve(Page.Entries.Num() + LeaderboardEntries.Num());
+            for (const FLeaderboardEntry& Entry : Page.Entries)
+            {
+                NewEntries.Add(AcquireEntry(Entry));
+            }
+            NewEntries.Append(LeaderboardEntries);
+            LeaderboardEntries = MoveTemp(NewEntries);
+            WindowFirstRank = Page.FirstRank;
+            TrimWindow(false);
+
+            bIsLoading = false;
+            BroadcastDataChanged();
+            OnWindowShifted.Broadcast(Page.Entries.Num());
+        });
+    return true;
+}
+
+void US_UI_VM_Leaderboards::ShowPage(FLeaderboardPage Page)
+{
+    ReleaseWindow();
+
+    WindowFirstRank = Page.FirstRank;
+    TotalEntries = Page.TotalEntries;
+    LeaderboardEntries.Reserve(Page.Entries.Num());
+    for (const FLeaderboardEntry& Entry : Page.Entries)
+    {
+        LeaderboardEntries.Add(AcquireEntry(Entry));
+    }
+
+    // Update loading state
+    bIsLoading = false;
+    BroadcastDataChanged();
+    OnWindowReset.Broadcast(Page.PlayerRank > 0 ? Page.PlayerRank - Page.FirstRank : 0);
+}
+
+US_UI_VM_LeaderboardEntry* US_UI_VM_Leaderboards::AcquireEntry(const FLeaderboardEntry& Entry)
+{
+    US_UI_VM_LeaderboardEntry* VMEntry = EntryPool.Num() > 0
+        ? EntryPool.Pop(EAllowShrinking::No).Get()
+        : NewObject<US_UI_VM_LeaderboardEntry>(this);
+    VMEntry->SetFromEntry(Entry);
+    return VMEntry;
+}
+
+void US_UI_VM_Leaderboards::ReleaseWindow()
+{
+    for (UObject* Entry : LeaderboardEntries)
+    {
+        if (US_UI_VM_LeaderboardEntry* VMEntry = Cast<US_UI_VM_LeaderboardEntry>(Entry))
+        {
+            EntryPool.Add(VMEntry);
+        }
+    }
+    LeaderboardEntries.Reset();
+}
+
+int32 US_UI_VM_Leaderboards::TrimWindow(bool bFromFront)
+{
+    const int32 MaxEntries = FMath::Max(MaxWindowPages, 2) * PageSize;
+    const int32 NumExcess = LeaderboardEntries.Num() - MaxEntries;
+    if (NumExcess <= 0)
+    {
+        return 0;
+    }
+
+    const int32 FirstReleased = bFromFront ? 0 : MaxEntries;
+    for (int32 Index = FirstReleased; Index < FirstReleased + NumExcess; ++Index)
+    {
+        if (US_UI_VM_LeaderboardEntry* VMEntry = Cast<US_UI_VM_LeaderboardEntry>(LeaderboardEntries[Index]))
+        {
+            EntryPool.Add(VMEntry);
+        }
+    }
+    LeaderboardEntries.RemoveAt(FirstReleased, NumExcess, EAllowShrinking::No);
+
+    if (bFromFront)
+    {
+        WindowFirstRank += NumExcess;
+    }
+    return NumExcess;
+}
+
+FString US_UI_VM_Leaderboards::GetLocalPlayerId() const
+{
+    const UWorld* World = GetWorld();
+    const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    const APlayerState* PlayerState = PC ? PC->PlayerState.Get() : nullptr;
+    if (!PlayerState)
+    {
+        return FString();
+    }
+
+    const FUniqueNetIdRepl& UniqueId = PlayerState->GetUniqueId();
+    return UniqueId.IsValid() ? UniqueId.ToString() : PlayerState->GetPlayerName();
 }
 
 void US_UI_VM_Leaderboards::PlayReplayForEntry(UObject* EntryObject)
@@ -84,7 +247,7 @@ void US_UI_VM_Leaderboards::PlayReplayForEntry(UObject* EntryObject)
     }
 }
 
-FString US_UI_VM_Leaderboards::FormatTime(float TimeInSeconds) const
+FString US_UI_VM_LeaderboardEntry::FormatTime(float TimeInSeconds)
 {
     int32 Minutes = FMath::FloorToInt(TimeInSeconds / 60.0f);
     float Seconds = TimeInSeconds - (Minutes * 60.0f);
@@ -42,6 +42,10 @@ void US_UI_VM_Replays::RefreshReplays()
                 Entry->FileName = Info.FileName;
                 Entry->Timestamp = Info.Timestamp;
                 Entry->FileSizeKB = Info.FileSizeKB;
+                Entry->MapName = Info.MapName;
+                Entry->GameMode = Info.GameMode;
+                Entry->DurationSeconds = Info.DurationSeconds;
+                Entry->NumPlayers = Info.NumPlayers;
                 Entry->FormattedTimestamp = FormatTimestamp(Info.Timestamp);
                 Entry->FileSizeText = FormatFileSize(Info.FileSizeKB);
 
@@ -89,6 +93,51 @@ void US_UI_VM_Replays::DeleteSelectedReplay()
     }
 }
 
+void US_UI_VM_Replays::SeekReplay(float TimeSeconds)
+{
+    if (!ReplayService)
+    {
+        return;
+    }
+
+    // The seek finishes asynchronously and can outlive this view model.
+    TWeakObjectPtr<US_UI_VM_Replays> WeakThis(this);
+    const bool bStarted = ReplayService->SeekReplay(TimeSeconds,
+        [WeakThis](bool bSuccess)
+        {
+            if (!bSuccess)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Replay seek failed"));
+            }
+            if (US_UI_VM_Replays* ViewModel = WeakThis.Get())
+            {
+                ViewModel->bIsSeeking = false;
+                ViewModel->BroadcastDataChanged();
+            }
+        });
+
+    if (bStarted && !bIsSeeking)
+    {
+        bIsSeeking = true;
+        BroadcastDataChanged();
+    }
+}
+
+void US_UI_VM_Replays::SeekReplayToFraction(float Fraction)
+{
+    SeekReplay(FMath::Clamp(Fraction, 0.0f, 1.0f) * GetPlaybackLength());
+}
+
+float US_UI_VM_Replays::GetPlaybackTime() const
+{
+    return ReplayService ? ReplayService->GetReplayCurrentTime() : 0.0f;
+}
+
+float US_UI_VM_Replays::GetPlaybackLength() const
+{
+    return ReplayService ? ReplayService->GetReplayTotalTime() : 0.0f;
+}
+
 void US_UI_VM_Replays::SetSelectedReplay(UObject* ReplayEntry)
 {
     if (SelectedReplay != ReplayEntry)
@@ -2,6 +2,9 @@
 
 #include "ViewModel/S_UI_VM_ServerBrowser.h"
 #include "S_UI_Subsystem.h"
+#include "Services/S_PingService.h"
+#include "OnlineSubsystemUtils.h"
+#include "SocketSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "GameFramework/PlayerController.h"
@@ -32,12 +35,19 @@ void US_UI_VM_ServerBrowser::Initialize()
 		if (MultiplayerSubsystem)
 		{
 			// Bind to find sessions complete delegates
-			MultiplayerSubsystem->OnFindLobbiesComplete.AddUObject(this, &US_UI_VM_ServerBrowser::OnFindSessionsComplete);
-			MultiplayerSubsystem->OnFindDedicatedServersComplete.AddUObject(this, &US_UI_VM_ServerBrowser::OnFindSessionsComplete);
+			MultiplayerSubsystem->OnFindLobbiesComplete.AddUObject(this, &US_UI_VM_ServerBrowser::OnFindLobbiesComplete);
+			MultiplayerSubsystem->OnFindDedicatedServersComplete.AddUObject(this, &US_UI_VM_ServerBrowser::OnFindDedicatedServersComplete);
+			MultiplayerSubsystem->OnFindSessionsProgress.AddUObject(this, &US_UI_VM_ServerBrowser::OnFindSessionsProgress);
 
 			// Bind to join session complete delegate
 			MultiplayerSubsystem->OnJoinSessionComplete.AddUObject(this, &US_UI_VM_ServerBrowser::OnJoinSessionComplete);
 		}
+
+		PingService = GameInstance->GetSubsystem<US_PingService>();
+		if (PingService)
+		{
+			PingService->OnPingMeasured.AddUObject(this, &US_UI_VM_ServerBrowser::OnServerPingMeasured);
+		}
 	}
 }
 
@@ -51,123 +61,333 @@ void US_UI_VM_ServerBrowser::RequestServerListRefresh()
 
 	UE_LOG(LogTemp, Log, TEXT("Refreshing server list..."));
 
-	// Clear existing lists
-	ServerList.Empty();
-	AllFoundServers.Empty();
+	// Clear existing lists, keeping the entry objects for the new results
+	EntryPool.Append(AllFoundServers);
+	AllFoundServers.Reset();
+	SearchIndex.Reset();
+	NotFullBits.Reset();
+	NotEmptyBits.Reset();
+	PublicBits.Reset();
+	PingOrder.Reset();
+	PlayerOrder.Reset();
+	bSortOrdersDirty = false;
+	ServersByPingHost.Reset();
+	if (PingService)
+	{
+		PingService->CancelPendingPings();
+	}
+	FilteredEntries.Reset();
+	ServerList.Reset();
+	PendingResults.Reset();
+	PendingResultIndex = 0;
+	QueuedLobbyResults = 0;
+	QueuedDedicatedResults = 0;
 	BroadcastDataChanged();
 
 	// Search for both lobbies and dedicated servers
 	if (bSearchLAN)
 	{
 		// For LAN, just search for lobbies
+		ActiveSearches = 1;
 		MultiplayerSubsystem->FindLobbies();
 	}
 	else
 	{
 		// For online, search for both
+		ActiveSearches = 2;
 		MultiplayerSubsystem->FindLobbies();
 		MultiplayerSubsystem->FindDedicatedServers();
 	}
 }
 
-void US_UI_VM_ServerBrowser::OnFindSessionsComplete(const TArray<FOnlineSessionSearchResult>& SessionResults, EMultiplayerSessionResult Result)
+void US_UI_VM_ServerBrowser::BeginDestroy()
 {
-	if (Result != EMultiplayerSessionResult::Success)
+	if (ProcessTickerHandle.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Session search failed. Result: %d"), (int32)Result);
+		FTSTicker::GetCoreTicker().RemoveTicker(ProcessTickerHandle);
+		ProcessTickerHandle.Reset();
+	}
+	if (FilterDebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FilterDebounceHandle);
+		FilterDebounceHandle.Reset();
+	}
+	Super::BeginDestroy();
+}
 
-		if (Result == EMultiplayerSessionResult::Find_NoResults)
-		{
-			// No servers found - show modal
-			if (UWorld* World = GetWorld())
-			{
-				if (US_UI_Subsystem* UISubsystem = World->GetGameInstance()->GetSubsystem<US_UI_Subsystem>())
-				{
-					F_UIModalPayload Payload;
-					Payload.Message = FText::FromString(TEXT("No game sessions found. Try creating your own!"));
-					Payload.ModalType = E_UIModalType::OK;
-					UISubsystem->RequestModal(Payload, FOnModalDismissedSignature());
-				}
-			}
-		}
+void US_UI_VM_ServerBrowser::OnFindSessionsProgress(const TArray<FOnlineSessionSearchResult>& SearchResultsSoFar, bool bDedicatedSearch)
+{
+	EnqueueResults(SearchResultsSoFar, bDedicatedSearch);
+}
+
+void US_UI_VM_ServerBrowser::OnFindLobbiesComplete(const TArray<FOnlineSessionSearchResult>& SessionResults, EMultiplayerSessionResult Result)
+{
+	EnqueueResults(SessionResults, false);
+	OnSearchFinished(Result);
+}
+
+void US_UI_VM_ServerBrowser::OnFindDedicatedServersComplete(const TArray<FOnlineSessionSearchResult>& SessionResults, EMultiplayerSessionResult Result)
+{
+	EnqueueResults(SessionResults, true);
+	OnSearchFinished(Result);
+}
+
+void US_UI_VM_ServerBrowser::EnqueueResults(const TArray<FOnlineSessionSearchResult>& SearchResultsSoFar, bool bDedicatedSearch)
+{
+	int32& QueuedResults = bDedicatedSearch ? QueuedDedicatedResults : QueuedLobbyResults;
+	if (SearchResultsSoFar.Num() <= QueuedResults)
+	{
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Session search complete. Found %d sessions"), SessionResults.Num());
+	for (int32 Index = QueuedResults; Index < SearchResultsSoFar.Num(); ++Index)
+	{
+		PendingResults.Add(SearchResultsSoFar[Index]);
+	}
+	QueuedResults = SearchResultsSoFar.Num();
+
+	if (!ProcessTickerHandle.IsValid())
+	{
+		ProcessTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &US_UI_VM_ServerBrowser::ProcessPendingResults));
+	}
+}
 
-	// Process each found session
-	for (const FOnlineSessionSearchResult& SearchResult : SessionResults)
+void US_UI_VM_ServerBrowser::OnSearchFinished(EMultiplayerSessionResult Result)
+{
+	if (Result != EMultiplayerSessionResult::Success && Result != EMultiplayerSessionResult::Find_NoResults)
 	{
-		US_UI_VM_ServerListEntry* NewEntry = NewObject<US_UI_VM_ServerListEntry>(this);
+		UE_LOG(LogTemp, Warning, TEXT("Session search failed. Result: %d"), (int32)Result);
+	}
 
-		// Store the full search result for joining later
-		NewEntry->SessionSearchResult = SearchResult;
+	ActiveSearches = FMath::Max(ActiveSearches - 1, 0);
 
-		// Extract basic info
-		F_ServerInfo& ServerInfo = NewEntry->ServerInfo;
+	// Nothing from any search and nothing left to convert: tell the player.
+	if (!IsSearching() && AllFoundServers.Num() == 0)
+	{
+		ShowNoServersModal();
+	}
+}
 
-		// Get player counts
-		ServerInfo.PlayerCount = SearchResult.Session.SessionSettings.NumPublicConnections - SearchResult.Session.NumOpenPublicConnections;
-		ServerInfo.MaxPlayers = SearchResult.Session.SessionSettings.NumPublicConnections;
+bool US_UI_VM_ServerBrowser::ProcessPendingResults(float DeltaTime)
+{
+	const int32 FirstNewFiltered = FilteredEntries.Num();
+	const int32 EndIndex = FMath::Min(PendingResultIndex + FMath::Max(MaxEntriesPerFrame, 1), PendingResults.Num());
+	const bool bAppendInArrivalOrder = SortMode == E_ServerBrowserSort::Arrival;
+	bool bSortedListNeedsRebuild = false;
 
-		// Get ping
-		ServerInfo.Ping = SearchResult.PingInMs;
+	PrepareFilterTokens();
 
-		// Get basic settings
-		ServerInfo.bIsPrivate = !SearchResult.Session.SessionSettings.bShouldAdvertise;
-		ServerInfo.bIsLAN = SearchResult.Session.SessionSettings.bIsLANMatch;
+	for (; PendingResultIndex < EndIndex; ++PendingResultIndex)
+	{
+		US_UI_VM_ServerListEntry* NewEntry = AcquireEntry();
 
-		// Get custom session data using StrafeMultiplayer keys
-		FString GameMode;
-		if (SearchResult.Session.SessionSettings.Get(FName(TEXT("GAME_MODE")), GameMode))
-		{
-			ServerInfo.GameMode = FText::FromString(GameMode);
-		}
-		else
-		{
-			ServerInfo.GameMode = FText::FromString(TEXT("Unknown"));
-		}
+		// Store the full search result for joining later
+		NewEntry->SessionSearchResult = MoveTemp(PendingResults[PendingResultIndex]);
+		FillServerInfo(NewEntry->ServerInfo, NewEntry->SessionSearchResult);
+		const int32 ServerIndex = AllFoundServers.Add(NewEntry);
+		RequestEntryPing(ServerIndex);
+		IndexServer(ServerIndex);
 
-		FString MapName;
-		if (SearchResult.Session.SessionSettings.Get(FName(TEXT("MAP_NAME")), MapName))
+		if (!PassesFilters(ServerIndex))
 		{
-			ServerInfo.CurrentMap = MapName;
-		}
-		else
-		{
-			ServerInfo.CurrentMap = TEXT("Unknown");
+			continue;
 		}
 
-		// For server name, use the owner's name or a custom game name if available
-		FString GameName;
-		if (SearchResult.Session.SessionSettings.Get(FName(TEXT("GAME_NAME")), GameName))
+		if (bAppendInArrivalOrder)
 		{
-			ServerInfo.ServerName = FText::FromString(GameName);
-		}
-		else if (!SearchResult.Session.OwningUserName.IsEmpty())
-		{
-			ServerInfo.ServerName = FText::FromString(SearchResult.Session.OwningUserName + TEXT("'s Game"));
+			FilteredEntries.Add(NewEntry);
+			ServerList.Add(NewEntry->ServerInfo);
 		}
 		else
 		{
-			ServerInfo.ServerName = FText::FromString(TEXT("Unknown Server"));
+			bSortedListNeedsRebuild = true;
 		}
+	}
 
-		// Check if it's a dedicated server
-		bool bIsDedicated = false;
-		SearchResult.Session.SessionSettings.Get(FName(TEXT("IS_DEDICATED")), bIsDedicated);
+	if (FilteredEntries.Num() > FirstNewFiltered)
+	{
+		OnEntriesAppended.Broadcast(FirstNewFiltered, FilteredEntries.Num() - FirstNewFiltered);
+	}
+
+	// New entries land in the middle of a sorted list; rebuild it a few times a second rather than every chunk.
+	if (bSortedListNeedsRebuild && !FilterDebounceHandle.IsValid())
+	{
+		ApplyFilters();
+	}
+
+	if (PendingResultIndex < PendingResults.Num())
+	{
+		return true;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Server list now has %d sessions (%d shown)"), AllFoundServers.Num(), FilteredEntries.Num());
+	PendingResults.Reset();
+	PendingResultIndex = 0;
+	ProcessTickerHandle.Reset();
+	return false;
+}
+
+void US_UI_VM_ServerBrowser::RequestEntryPing(int32 ServerIndex)
+{
+	if (!PingService || !bProbeServerPings)
+	{
+		return;
+	}
+
+	US_UI_VM_ServerListEntry* Entry = AllFoundServers[ServerIndex];
+	const FString HostAddress = ResolvePingHost(Entry->SessionSearchResult);
+	if (HostAddress.IsEmpty())
+	{
+		return;
+	}
+
+	ServersByPingHost.FindOrAdd(HostAddress).Add(ServerIndex);
+
+	int32 CachedPingMs = 0;
+	if (PingService->GetCachedPing(HostAddress, CachedPingMs))
+	{
+		Entry->ServerInfo.Ping = CachedPingMs;
+	}
+	else
+	{
+		PingService->RequestPing(HostAddress);
+	}
+}
+
+void US_UI_VM_ServerBrowser::OnServerPingMeasured(const FString& HostAddress, int32 PingMs)
+{
+	const TArray<int32, TInlineAllocator<1>>* ServerIndices = ServersByPingHost.Find(HostAddress);
+	if (!ServerIndices)
+	{
+		return;
+	}
+
+	bool bListAffected = SortMode == E_ServerBrowserSort::Ping;
+	for (const int32 ServerIndex : *ServerIndices)
+	{
+		US_UI_VM_ServerListEntry* Entry = AllFoundServers[ServerIndex];
+		const int32 OldPingMs = Entry->ServerInfo.Ping;
+		Entry->ServerInfo.Ping = PingMs;
+		Entry->OnPingUpdated.Broadcast();
+
+		bListAffected |= (OldPingMs > FilterMaxPing) != (PingMs > FilterMaxPing);
+	}
+	bSortOrdersDirty = true;
+
+	// Rows already showing the entry update themselves; only rebuild when the ping moves an entry or hides/shows it.
+	if (bListAffected && !FilterDebounceHandle.IsValid())
+	{
+		ApplyFilters();
+	}
+}
+
+FString US_UI_VM_ServerBrowser::ResolvePingHost(const FOnlineSessionSearchResult& SearchResult) const
+{
+	const IOnlineSessionPtr SessionInterface = Online::GetSessionInterface(GetWorld());
+	FString ConnectString;
+	if (!SessionInterface.IsValid() || !SessionInterface->GetResolvedConnectString(SearchResult, NAME_GamePort, ConnectString))
+	{
+		return FString();
+	}
+
+	FString HostAddress = ConnectString;
+	ConnectString.Split(TEXT(":"), &HostAddress, nullptr, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+
+	// Steam P2P lobbies resolve to "steam.<id>", which can't be pinged directly; their search ping is already measured.
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!SocketSubsystem || !SocketSubsystem->GetAddressFromString(HostAddress).IsValid())
+	{
+		return FString();
+	}
+	return HostAddress;
+}
+
+US_UI_VM_ServerListEntry* US_UI_VM_ServerBrowser::AcquireEntry()
+{
+	if (EntryPool.Num() > 0)
+	{
+		return EntryPool.Pop(EAllowShrinking::No);
+	}
+	return NewObject<US_UI_VM_ServerListEntry>(this);
+}
 
-		if (bIsDedicated)
+void US_UI_VM_ServerBrowser::ShowNoServersModal()
+{
+	// No servers found - show modal
+	if (UWorld* World = GetWorld())
+	{
+		if (US_UI_Subsystem* UISubsystem = World->GetGameInstance()->GetSubsystem<US_UI_Subsystem>())
 		{
-			// Override the server name for dedicated servers
-			ServerInfo.ServerName = FText::FromString(FString::Printf(TEXT("DEDI - %s (%s)"), *GameMode, *MapName));
+			F_UIModalPayload Payload;
+			Payload.Message = FText::FromString(TEXT("No game sessions found. Try creating your own!"));
+			Payload.ModalType = E_UIModalType::OK;
+			UISubsystem->RequestModal(Payload, FOnModalDismissedSignature());
 		}
+	}
+}
+
+void US_UI_VM_ServerBrowser::FillServerInfo(F_ServerInfo& ServerInfo, const FOnlineSessionSearchResult& SearchResult)
+{
+	// Pooled entries carry the previous result's values; start from scratch
+	ServerInfo = F_ServerInfo();
+
+	// Get player counts
+	ServerInfo.PlayerCount = SearchResult.Session.SessionSettings.NumPublicConnections - SearchResult.Session.NumOpenPublicConnections;
+	ServerInfo.MaxPlayers = SearchResult.Session.SessionSettings.NumPublicConnections;
+
+	// Get ping
+	ServerInfo.Ping = SearchResult.PingInMs;
+
+	// Get basic settings
+	ServerInfo.bIsPrivate = !SearchResult.Session.SessionSettings.bShouldAdvertise;
+	ServerInfo.bIsLAN = SearchResult.Session.SessionSettings.bIsLANMatch;
+
+	// Get custom session data using StrafeMultiplayer keys
+	FString GameMode;
+	if (SearchResult.Session.SessionSettings.Get(FName(TEXT("GAME_MODE")), GameMode))
+	{
+		ServerInfo.GameMode = FText::FromString(GameMode);
+	}
+	else
+	{
+		ServerInfo.GameMode = FText::FromString(TEXT("Unknown"));
+	}
 
-		AllFoundServers.Add(NewEntry);
+	FString MapName;
+	if (SearchResult.Session.SessionSettings.Get(FName(TEXT("MAP_NAME")), MapName))
+	{
+		ServerInfo.CurrentMap = MapName;
+	}
+	else
+	{
+		ServerInfo.CurrentMap = TEXT("Unknown");
 	}
 
-	// Apply filters to show results
-	UpdateFilteredServerList();
+	// For server name, use the owner's name or a custom game name if available
+	FString GameName;
+	if (SearchResult.Session.SessionSettings.Get(FName(TEXT("GAME_NAME")), GameName))
+	{
+		ServerInfo.ServerName = FText::FromString(GameName);
+	}
+	else if (!SearchResult.Session.OwningUserName.IsEmpty())
+	{
+		ServerInfo.ServerName = FText::FromString(SearchResult.Session.OwningUserName + TEXT("'s Game"));
+	}
+	else
+	{
+		ServerInfo.ServerName = FText::FromString(TEXT("Unknown Server"));
+	}
+
+	// Check if it's a dedicated server
+	bool bIsDedicated = false;
+	SearchResult.Session.SessionSettings.Get(FName(TEXT("IS_DEDICATED")), bIsDedicated);
+
+	if (bIsDedicated)
+	{
+		// Override the server name for dedicated servers
+		ServerInfo.ServerName = FText::FromString(FString::Printf(TEXT("DEDI - %s (%s)"), *GameMode, *MapName));
+	}
 }
 
 void US_UI_VM_ServerBrowser::JoinSession(const FOnlineSessionSearchResult& SessionSearchResult)
@@ -229,21 +449,82 @@ void US_UI_VM_ServerBrowser::OnJoinSessionComplete(EMultiplayerSessionResult Res
 	}
 }
 
-void US_UI_VM_ServerBrowser::ApplyFilters()
+void US_UI_VM_ServerBrowser::ApplyFilters(bool bImmediate)
+{
+	if (bImmediate || FilterDebounceSeconds <= 0.f)
+	{
+		if (FilterDebounceHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(FilterDebounceHandle);
+			FilterDebounceHandle.Reset();
+		}
+		UpdateFilteredServerList();
+		return;
+	}
+
+	// Restart the wait on every call so typing a word costs one filter pass, not one per keystroke.
+	if (FilterDebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FilterDebounceHandle);
+	}
+	FilterDebounceHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &US_UI_VM_ServerBrowser::HandleFilterDebounce), FilterDebounceSeconds);
+}
+
+bool US_UI_VM_ServerBrowser::HandleFilterDebounce(float DeltaTime)
 {
+	FilterDebounceHandle.Reset();
 	UpdateFilteredServerList();
+	return false;
 }
 
 void US_UI_VM_ServerBrowser::UpdateFilteredServerList()
 {
-	ServerList.Empty();
+	ServerList.Reset();
+	FilteredEntries.Reset();
+
+	PrepareFilterTokens();
 
-	// Apply filters to the full list
-	for (const TObjectPtr<US_UI_VM_ServerListEntry>& Entry : AllFoundServers)
+	if (SortMode == E_ServerBrowserSort::Arrival)
+	{
+		for (int32 ServerIndex = 0; ServerIndex < AllFoundServers.Num(); ++ServerIndex)
+		{
+			if (PassesFilters(ServerIndex))
+			{
+				FilteredEntries.Add(AllFoundServers[ServerIndex]);
+				ServerList.Add(AllFoundServers[ServerIndex]->ServerInfo);
+			}
+		}
+	}
+	else
 	{
-		if (PassesFilters(Entry))
+		if (bSortOrdersDirty)
 		{
-			ServerList.Add(Entry->ServerInfo);
+			PingOrder.Sort([this](int32 A, int32 B)
+			{
+				return AllFoundServers[A]->ServerInfo.Ping < AllFoundServers[B]->ServerInfo.Ping;
+			});
+			PlayerOrder.Sort([this](int32 A, int32 B)
+			{
+				return AllFoundServers[A]->ServerInfo.PlayerCount > AllFoundServers[B]->ServerInfo.PlayerCount;
+			});
+			bSortOrdersDirty = false;
+		}
+
+		const bool bByPing = SortMode == E_ServerBrowserSort::Ping;
+		for (const int32 ServerIndex : bByPing ? PingOrder : PlayerOrder)
+		{
+			// Everything after the first server over the ping limit is over it too.
+			if (bByPing && AllFoundServers[ServerIndex]->ServerInfo.Ping > FilterMaxPing)
+			{
+				break;
+			}
+
+			if (PassesFilters(ServerIndex))
+			{
+				FilteredEntries.Add(AllFoundServers[ServerIndex]);
+				ServerList.Add(AllFoundServers[ServerIndex]->ServerInfo);
+			}
 		}
 	}
 
@@ -251,56 +532,111 @@ void US_UI_VM_ServerBrowser::UpdateFilteredServerList()
 	BroadcastDataChanged();
 }
 
-bool US_UI_VM_ServerBrowser::PassesFilters(const TObjectPtr<US_UI_VM_ServerListEntry>& Entry) const
+bool US_UI_VM_ServerBrowser::PassesFilters(int32 ServerIndex) const
 {
-	if (!Entry)
+	if (!AllFoundServers.IsValidIndex(ServerIndex) || !AllFoundServers[ServerIndex])
 	{
 		return false;
 	}
 
-	const F_ServerInfo& ServerInfo = Entry->ServerInfo;
-
-	// Filter by server name
-	if (!FilterServerName.IsEmpty())
+	// Cheapest checks first: one bit each
+	if (bFilterHideFullServers && !NotFullBits[ServerIndex])
 	{
-		if (!ServerInfo.ServerName.ToString().Contains(FilterServerName, ESearchCase::IgnoreCase))
-		{
-			return false;
-		}
+		return false;
 	}
-
-	// Filter by game mode
-	if (!FilterGameMode.IsEmpty())
+	if (bFilterHideEmptyServers && !NotEmptyBits[ServerIndex])
 	{
-		if (!ServerInfo.GameMode.ToString().Contains(FilterGameMode, ESearchCase::IgnoreCase))
-		{
-			return false;
-		}
+		return false;
 	}
-
-	// Filter by ping
-	if (ServerInfo.Ping > FilterMaxPing)
+	if (bFilterHidePrivateServers && !PublicBits[ServerIndex])
 	{
 		return false;
 	}
 
-	// Filter full servers
-	if (bFilterHideFullServers && ServerInfo.PlayerCount >= ServerInfo.MaxPlayers)
+	// Filter by ping
+	if (AllFoundServers[ServerIndex]->ServerInfo.Ping > FilterMaxPing)
 	{
 		return false;
 	}
 
-	// Filter empty servers
-	if (bFilterHideEmptyServers && ServerInfo.PlayerCount == 0)
+	// Filter by server name and game mode against the pre-lowered index
+	const FServerSearchIndexEntry& Indexed = SearchIndex[ServerIndex];
+	return MatchesTokens(Indexed.LowerServerName, Indexed.ServerNameCharMask, ServerNameTokens)
+		&& MatchesTokens(Indexed.LowerGameMode, Indexed.GameModeCharMask, GameModeTokens);
+}
+
+void US_UI_VM_ServerBrowser::IndexServer(int32 ServerIndex)
+{
+	const F_ServerInfo& ServerInfo = AllFoundServers[ServerIndex]->ServerInfo;
+
+	FServerSearchIndexEntry& Indexed = SearchIndex.AddDefaulted_GetRef();
+	check(SearchIndex.Num() == ServerIndex + 1);
+	Indexed.LowerServerName = ServerInfo.ServerName.ToString().ToLower();
+	Indexed.LowerGameMode = ServerInfo.GameMode.ToString().ToLower();
+	Indexed.ServerNameCharMask = MakeCharMask(Indexed.LowerServerName);
+	Indexed.GameModeCharMask = MakeCharMask(Indexed.LowerGameMode);
+
+	NotFullBits.Add(ServerInfo.PlayerCount < ServerInfo.MaxPlayers);
+	NotEmptyBits.Add(ServerInfo.PlayerCount != 0);
+	PublicBits.Add(!ServerInfo.bIsPrivate);
+
+	PingOrder.Add(ServerIndex);
+	PlayerOrder.Add(ServerIndex);
+	bSortOrdersDirty = true;
+}
+
+void US_UI_VM_ServerBrowser::PrepareFilterTokens()
+{
+	auto Tokenize = [](const FString& Filter, TArray<FSearchToken>& OutTokens)
 	{
-		return false;
-	}
+		OutTokens.Reset();
+		TArray<FString> Words;
+		Filter.ToLower().ParseIntoArrayWS(Words);
+		for (FString& Word : Words)
+		{
+			FSearchToken& Token = OutTokens.AddDefaulted_GetRef();
+			Token.CharMask = MakeCharMask(Word);
+			Token.Text = MoveTemp(Word);
+		}
+	};
 
-	// Filter private servers
-	if (bFilterHidePrivateServers && ServerInfo.bIsPrivate)
+	Tokenize(FilterServerName, ServerNameTokens);
+	Tokenize(FilterGameMode, GameModeTokens);
+}
+
+uint64 US_UI_VM_ServerBrowser::MakeCharMask(const FString& LowerText)
+{
+	uint64 Mask = 0;
+	for (const TCHAR Character : LowerText)
 	{
-		return false;
+		uint32 Bit;
+		if (Character >= TEXT('a') && Character <= TEXT('z'))
+		{
+			Bit = Character - TEXT('a');
+		}
+		else if (Character >= TEXT('0') && Character <= TEXT('9'))
+		{
+			Bit = 26 + (Character - TEXT('0'));
+		}
+		else
+		{
+			// Everything else shares the remaining bits; collisions only make the pre-check less selective.
+			Bit = 36 + static_cast<uint32>(Character) % 28;
+		}
+		Mask |= uint64(1) << Bit;
 	}
+	return Mask;
+}
 
+bool US_UI_VM_ServerBrowser::MatchesTokens(const FString& LowerText, uint64 TextCharMask, const TArray<FSearchToken>& Tokens)
+{
+	for (const FSearchToken& Token : Tokens)
+	{
+		if ((Token.CharMask & ~TextCharMask) != 0
+			|| !LowerText.Contains(Token.Text, ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+	}
 	return true;
-}
\ No newline at end of file
+}
@@ -10,6 +10,8 @@
 // Forward declarations
 class US_UI_Subsystem;
 class US_UI_ModalWidget;
+class APlayerController;
+class SWidget;
 
 /**
  * @struct F_UIModalRequest
@@ -26,6 +28,24 @@ struct F_UIModalRequest
 	FOnModalDismissedSignature OnDismissedCallback;
 };
 
+/**
+ * @struct F_UIPooledModal
+ * @brief A modal widget kept built between uses, with the Slate tree that would otherwise be released when it leaves the viewport.
+ */
+USTRUCT()
+struct F_UIPooledModal
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<US_UI_ModalWidget> Widget;
+
+	TSharedPtr<SWidget> SlateWidget;
+
+	/** True while the widget is the active modal. */
+	bool bInUse = false;
+};
+
 
 /**
  * @class US_UI_ModalStack
@@ -43,18 +63,46 @@ public:
 	/** Queues a new modal dialog request. */
 	void QueueModal(const F_UIModalPayload& Payload, const FOnModalDismissedSignature& OnDismissedCallback);
 
+	/** Builds the pooled modal widget for a player ahead of time, so the first modal shown doesn't construct one. */
+	void PrewarmModalWidgets(APlayerController* OwningPlayer);
+
 private:
 	/** Attempts to display the next modal from the queue if one is not already active. */
 	void TryDisplayNextModal();
 
+	/** Returns an idle pooled modal owned by OwningPlayer, building one if there is none. */
+	US_UI_ModalWidget* AcquireModalWidget(APlayerController* OwningPlayer);
+
+	/** Returns a dismissed modal to the pool. */
+	void ReleaseModalWidget(US_UI_ModalWidget* Modal);
+
+	/** Appends a request to the ring buffer, doubling its capacity if it is full. */
+	void EnqueueRequest(const F_UIModalPayload& Payload, const FOnModalDismissedSignature& OnDismissedCallback);
+
+	/** Removes the oldest request from the ring buffer. */
+	F_UIModalRequest DequeueRequest();
+
 	/** Handles the dismissal of the active modal. */
 	UFUNCTION()
 	void OnModalDismissed(bool bConfirmed);
 
-	/** The queue of modal dialogs waiting to be displayed. */
+	/**
+	 * Ring buffer of modal dialogs waiting to be displayed. Slots are reused, so queuing allocates nothing
+	 * until more requests are pending than ever before.
+	 */
 	UPROPERTY()
 	TArray<F_UIModalRequest> ModalRequestQueue;
 
+	/** Index of the oldest pending request in ModalRequestQueue. */
+	int32 QueueHead = 0;
+
+	/** Number of pending requests in ModalRequestQueue. */
+	int32 QueueCount = 0;
+
+	/** Modal widgets built so far. Modals display one at a time, so this rarely holds more than one. */
+	UPROPERTY()
+	TArray<F_UIPooledModal> ModalWidgetPool;
+
 	/** Pointer to the currently displayed modal widget, if any. */
 	UPROPERTY()
 	TObjectPtr<US_UI_ModalWidget> ActiveModal;
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "Containers/Ticker.h"
 #include "Data/S_UI_ScreenTypes.h"
 #include "S_UI_Navigator.generated.h"
 
@@ -9,9 +10,43 @@ class US_UI_RootWidget;
 class US_UI_AssetManager;
 class IViewModelProvider;
 class US_UI_ViewModelBase;
+class UCommonActivatableWidget;
+class UUserWidget;
+class SWidget;
+
+/**
+ * A content screen kept alive by the navigator while it is not on the content stack.
+ */
+USTRUCT()
+struct FCachedContentScreen
+{
+    GENERATED_BODY()
+
+    /** The screen widget. Re-added to the content stack as-is when the screen is shown again. */
+    UPROPERTY()
+    TObjectPtr<UCommonActivatableWidget> Widget;
+
+    /** The view model bound to the screen. Screens only hold it weakly, so the cache owns it. */
+    UPROPERTY()
+    TObjectPtr<US_UI_ViewModelBase> ViewModel;
+
+    /** The content stack releases a screen's Slate tree when it is removed; holding it here keeps it built. */
+    TSharedPtr<SWidget> SlateWidget;
+
+    /** FPlatformTime::Seconds() when the screen was last shown, or created for preloaded screens. */
+    double LastUsedTime = 0.0;
+
+    /** Rough memory cost of the screen, measured once when it is built. */
+    int64 EstimatedBytes = 0;
+};
 
 /**
  * Manages UI screen transitions, including switching and popping screens.
+ *
+ * Screens are cached by E_UIScreenId together with their view models, so switching back to a screen
+ * re-adds the existing widget instead of rebuilding its tree and state. After each switch the screens most
+ * often opened next (learned from the session's own navigation) are preloaded, one per frame. Hidden screens
+ * are released least recently used first once their estimated size exceeds US_UI_Settings::ScreenCacheBudgetKB.
  */
 UCLASS()
 class STRAFEUI_API US_UI_Navigator : public UObject
@@ -32,7 +67,60 @@ public:
     /** Pops the current screen from the content stack. */
     void PopContentScreen();
 
+    /**
+     * Builds a screen and its view model ahead of time so the next switch to it is instant.
+     * Does nothing if the screen is already cached or assets are still loading.
+     */
+    void PreloadScreen(E_UIScreenId ScreenId);
+
+    /** Releases every cached screen that is not currently shown. */
+    void FlushScreenCache();
+
+    virtual void BeginDestroy() override;
+
 private:
+    /** Returns the cached screen for ScreenId, building the widget and its view model if needed. */
+    FCachedContentScreen* FindOrCreateScreen(E_UIScreenId ScreenId);
+
+    /** Hands a view model to a screen widget. Screen widgets take their view model through a typed SetViewModel. */
+    static void BindViewModel(UCommonActivatableWidget* Widget, US_UI_ViewModelBase* ViewModel);
+
+    /**
+     * Brings a screen's view model up to date right before it is shown. Cached screens reload their data (Settings
+     * drop unapplied edits); the server browser starts its search here, never while being built or preloaded.
+     */
+    static void RefreshViewModel(US_UI_ViewModelBase* ViewModel, bool bJustBuilt);
+
+    /** True while Widget is on the content stack, including while it is transitioning out. */
+    bool IsOnContentStack(const UCommonActivatableWidget* Widget) const;
+
+    /** The cached screen whose widget is active on the content stack, or None. */
+    E_UIScreenId GetActiveScreenId() const;
+
+    /** Approximate memory held by a widget tree, nested user widgets included. */
+    static int64 EstimateWidgetBytes(const UUserWidget* Widget);
+
+    /** Records the transition and queues the screens most likely to follow ScreenId. */
+    void SchedulePreload(E_UIScreenId FromScreenId, E_UIScreenId ToScreenId);
+
+    /** Builds one queued screen per tick so preloading never stalls a frame with several screens. */
+    bool HandlePreloadTick(float DeltaTime);
+
+    /** Releases hidden screens, least recently used first, until the cache fits the budget. */
+    void EnforceCacheBudget();
+
+    /** Screens built so far, shown or hidden. */
+    UPROPERTY()
+    TMap<E_UIScreenId, FCachedContentScreen> ScreenCache;
+
+    /** How often each (from, to) switch happened this session. Drives which screens are preloaded. */
+    TMap<TPair<E_UIScreenId, E_UIScreenId>, int32> TransitionCounts;
+
+    /** Screens waiting to be preloaded, most likely first. */
+    TArray<E_UIScreenId> PreloadQueue;
+
+    FTSTicker::FDelegateHandle PreloadTickHandle;
+
     /** A weak pointer to the root UI widget. */
     UPROPERTY()
     TWeakObjectPtr<US_UI_RootWidget> UIRootWidget;
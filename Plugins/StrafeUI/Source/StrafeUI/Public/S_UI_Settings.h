@@ -108,6 +108,24 @@ public:
     TSoftClassPtr<US_UI_SettingsTabBase> PlayerSettingsTabClass;
     //~ End Settings Tab Classes
 
+    //~ Begin Screen Cache Settings
+    /**
+     * Approximate memory the navigator may spend on content screens kept alive while hidden.
+     * Least recently shown screens are released first once this is exceeded. The visible screen never counts.
+     * Zero disables the cache: every navigation builds its screen from scratch.
+     */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Screen Cache", meta = (ClampMin = "0", Units = "Kilobytes"))
+    int32 ScreenCacheBudgetKB = 8192;
+
+    /** If true, the screens the player is most likely to open next are built in the background, one per frame. */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Screen Cache")
+    bool bPreloadLikelyScreens = true;
+
+    /** How many likely-next screens to preload after each navigation. */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Screen Cache", meta = (ClampMin = "0", EditCondition = "bPreloadLikelyScreens"))
+    int32 MaxPreloadedScreens = 2;
+    //~ End Screen Cache Settings
+
     /** The widget class to use for the pause menu. */
     UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Core")
     TSoftClassPtr<US_UI_PauseMenuWidget> PauseMenuWidgetClass;
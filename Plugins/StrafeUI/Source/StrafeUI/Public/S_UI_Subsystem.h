@@ -13,6 +13,10 @@ class US_UI_RootWidget;
 class AS_UI_PlayerController;
 class US_UI_OnlineSessionManager;
 class US_UI_PauseMenuWidget;
+class APlayerController;
+class APawn;
+class AController;
+class SWidget;
 
 /**
  * The central orchestrator for the StrafeUI plugin.
@@ -51,10 +55,23 @@ public:
 
     /** Toggles the pause menu on or off. */
     void TogglePauseMenu();
+
+    /**
+     * Builds the pause menu and modal widgets for a player ahead of time, so opening them later allocates nothing.
+     * Runs automatically when the UI initializes and whenever a local player possesses a pawn.
+     */
+    void PrewarmPooledWidgets(APlayerController* PlayerController);
 private:
     /** Finalizes UI setup after all assets have been loaded. */
     void FinalizeUIInitialization();
 
+    /** Prewarms the pooled widgets when a local player takes control of a pawn, i.e. when a match starts. */
+    UFUNCTION()
+    void HandlePawnControllerChanged(APawn* Pawn, AController* Controller);
+
+    /** Returns the pooled pause menu for a player, building it if it doesn't exist or belongs to a previous player. */
+    US_UI_PauseMenuWidget* GetOrCreatePauseMenu(APlayerController* PlayerController);
+
     /** Manager for loading UI assets. */
     UPROPERTY()
     TObjectPtr<US_UI_AssetManager> AssetManager;
@@ -83,7 +100,10 @@ private:
     UPROPERTY()
     TWeakObjectPtr<AS_UI_PlayerController> InitializingPlayer;
 
-    /** The main pause menu widget instance. */
+    /** The pooled pause menu widget instance. Kept between uses instead of being rebuilt on every pause. */
     UPROPERTY()
     TObjectPtr<US_UI_PauseMenuWidget> PauseMenuWidgetInstance;
+
+    /** Keeps the pause menu's Slate tree alive while it is out of the viewport. */
+    TSharedPtr<SWidget> PauseMenuSlateWidget;
 };
\ No newline at end of file
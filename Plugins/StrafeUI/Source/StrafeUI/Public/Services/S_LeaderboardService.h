@@ -23,15 +23,41 @@ struct FLeaderboardEntry
     UPROPERTY(BlueprintReadOnly)
     float Time;
 
+    /** 1-based position on the board the entry was read from. */
+    UPROPERTY(BlueprintReadOnly)
+    int32 Rank;
+
+    /** US_LeaderboardStore record id, for anything stored next to the record (ghosts, replays). */
+    uint64 RecordId = 0;
+
     FLeaderboardEntry()
     {
         Time = 0.0f;
+        Rank = 0;
     }
 };
 
 /**
- * Mock service for fetching leaderboard data
- * In a real implementation, this would communicate with a backend service
+ * A contiguous window of a leaderboard, by rank.
+ */
+struct FLeaderboardPage
+{
+    /** Entries in rank order; Entries[0] has rank FirstRank. */
+    TArray<FLeaderboardEntry> Entries;
+
+    /** Rank of the first entry (1-based). */
+    int32 FirstRank = 1;
+
+    /** Number of ranked players on the whole board. */
+    int32 TotalEntries = 0;
+
+    /** Rank of the player the page was centred on, or 0. */
+    int32 PlayerRank = 0;
+};
+
+/**
+ * Service for fetching leaderboard data.
+ * Reads from the local US_LeaderboardStore; no online backend is involved.
  */
 UCLASS()
 class STRAFEUI_API US_LeaderboardService : public UObject
@@ -46,16 +72,31 @@ public:
      */
     void FetchLeaderboardData(const FString& MapName, TFunction<void(TArray<FLeaderboardEntry>)> OnComplete);
 
+    /**
+     * Fetches a window of a map's leaderboard by rank
+     * @param MapName The map whose leaderboard to read
+     * @param FirstRank 1-based rank of the first entry to return
+     * @param Count Maximum number of entries to return
+     * @param OnComplete Callback receiving the page; it is empty past the end of the board
+     */
+    void FetchLeaderboardPage(const FString& MapName, int32 FirstRank, int32 Count, TFunction<void(FLeaderboardPage)> OnComplete);
+
+    /**
+     * Fetches a window of a map's leaderboard with a player's personal best in the middle.
+     * Falls back to the top of the board if the player has no time on the map.
+     */
+    void FetchLeaderboardAroundPlayer(const FString& MapName, const FString& PlayerId, int32 Count, TFunction<void(FLeaderboardPage)> OnComplete);
+
     /**
      * Gets a list of all available map names that have leaderboards
      * @return Array of map names
      */
     TArray<FString> GetAvailableMapNames() const;
 
-private:
-    /** Timer handle for simulating network delay */
-    FTimerHandle FetchDelayTimerHandle;
+    /** Maximum number of entries returned by FetchLeaderboardData. */
+    static constexpr int32 MaxFetchedEntries = 100;
 
-    /** Generates mock leaderboard data */
-    TArray<FLeaderboardEntry> GenerateMockData(const FString& MapName) const;
+private:
+    /** Resolves the leaderboard store from the owning game instance. */
+    class US_LeaderboardStore* GetStore() const;
 };
\ No newline at end of file
@@ -0,0 +1,171 @@
+// Plugins/StrafeUI/Source/StrafeUI/Public/Services/S_LeaderboardStore.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "HAL/PlatformFile.h"
+#include "Services/S_LeaderboardService.h"
+#include "S_LeaderboardStore.generated.h"
+
+/**
+ * A single race time as persisted in the leaderboard log.
+ * Times are stored in whole milliseconds so ordering is exact.
+ */
+struct FLeaderboardRecord
+{
+    /** Monotonic id, unique within the store. Also used to name files stored next to the entry (e.g. ghosts). */
+    uint64 RecordId = 0;
+
+    FString MapName;
+
+    /** Hash of the checkpoint layout the time was set on. Never 0 (0 is the map-wide index). */
+    uint32 LayoutHash = 0;
+
+    /** Stable player identity (unique net id, or name when offline). */
+    FString PlayerId;
+
+    FString PlayerName;
+
+    int32 TimeMs = 0;
+
+    TArray<int32> SplitTimesMs;
+
+    /** Unix timestamp (seconds) when the time was set. */
+    int64 Timestamp = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FLeaderboardRecord& Record)
+    {
+        Ar << Record.RecordId;
+        Ar << Record.MapName;
+        Ar << Record.LayoutHash;
+        Ar << Record.PlayerId;
+        Ar << Record.PlayerName;
+        Ar << Record.TimeMs;
+        Ar << Record.SplitTimesMs;
+        Ar << Record.Timestamp;
+        return Ar;
+    }
+};
+
+/**
+ * Local, offline leaderboard database for Strafe race times.
+ *
+ * Records are appended to a framed, checksummed log in Saved/Leaderboards. On startup the log is replayed;
+ * a torn or corrupt tail (e.g. after a crash mid-write) is detected by its checksum and truncated away.
+ * Only personal bests are appended, so the log stays proportional to the number of ranked players.
+ *
+ * In memory, every (map, checkpoint layout) pair and every map as a whole has its own board: a sorted array
+ * of personal bests plus a player lookup, so top-N is a slice and rank-of-player is a binary search.
+ *
+ * The store is per game instance and is not replicated. Times are submitted by the authority (AS_StrafeManager),
+ * so in a listen-server or standalone game it holds every player's times, while on a dedicated server it lives
+ * on the server only: the Leaderboards screen of a connected client reads the client's own store, which only
+ * contains times set in games that client hosted or played offline.
+ */
+UCLASS()
+class STRAFEUI_API US_LeaderboardStore : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Layout hash used to query the map-wide board, which spans every checkpoint layout of the map. */
+    static constexpr uint32 AnyLayout = 0;
+
+    /**
+     * Submits a finished race. The record is persisted only if it is a personal best on its layout board.
+     * RecordId and Timestamp are assigned by the store.
+     * @return The assigned RecordId, or 0 if the time was not a personal best.
+     */
+    uint64 SubmitTime(FLeaderboardRecord Record);
+
+    /** Appends the best Count entries of a board, fastest first. */
+    void GetTopEntries(const FString& MapName, uint32 LayoutHash, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const;
+
+    /** Appends up to Count entries of a board starting at the 1-based FirstRank. Cost depends on Count only, not on the board size. */
+    void GetEntries(const FString& MapName, uint32 LayoutHash, int32 FirstRank, int32 Count, TArray<FLeaderboardEntry>& OutEntries) const;
+
+    /** Returns the 1-based rank of a player on a board, or 0 if the player has no time there. */
+    int32 GetPlayerRank(const FString& MapName, uint32 LayoutHash, const FString& PlayerId) const;
+
+    /** Returns the number of ranked players on a board. */
+    int32 GetNumEntries(const FString& MapName, uint32 LayoutHash) const;
+
+    /** Returns a player's personal best record on a board, or nullptr. */
+    const FLeaderboardRecord* FindPersonalBest(const FString& MapName, uint32 LayoutHash, const FString& PlayerId) const;
+
+    /** Returns every map that has at least one time, sorted alphabetically. */
+    TArray<FString> GetMapNames() const;
+
+    /** Directory holding the log and any per-record side files. */
+    static FString GetStoreDirectory();
+
+    /** Path of a file stored next to a record, e.g. GetRecordFilePath(Id, TEXT("ghost")) for its ghost run. */
+    static FString GetRecordFilePath(uint64 RecordId, const TCHAR* Extension);
+
+private:
+    struct FRankedTime
+    {
+        int32 TimeMs = 0;
+        int32 RecordIndex = INDEX_NONE;
+
+        /** Ties are broken by whoever set the time first. */
+        bool operator<(const FRankedTime& Other) const
+        {
+            return TimeMs != Other.TimeMs ? TimeMs < Other.TimeMs : RecordIndex < Other.RecordIndex;
+        }
+    };
+
+    struct FBoard
+    {
+        /** Personal bests, sorted fastest first. */
+        TArray<FRankedTime> Ranked;
+
+        /** PlayerId -> that player's entry in Ranked. */
+        TMap<FString, FRankedTime> BestByPlayer;
+    };
+
+    /**
+     * Inserts a record into its layout board and the map-wide board. Returns true if it improved the layout board.
+     * With bDeferRanking, only the player lookups are updated and RebuildRankings must be called afterwards.
+     */
+    bool IndexRecord(int32 RecordIndex, bool bDeferRanking = false);
+
+    /** Inserts into a single board if it is a personal best. Keeps Ranked sorted; used for new submissions. */
+    bool InsertIntoBoard(FBoard& Board, const FString& PlayerId, const FRankedTime& NewTime);
+
+    /** Records a personal best in BestByPlayer only. Used while loading; RebuildRankings sorts once at the end. */
+    static void UpdateBestByPlayer(FBoard& Board, const FString& PlayerId, const FRankedTime& NewTime);
+
+    /** Rebuilds every board's Ranked array from its BestByPlayer map with a single sort. */
+    void RebuildRankings();
+
+    const FBoard* FindBoard(const FString& MapName, uint32 LayoutHash) const;
+
+    static FString MakeBoardKey(const FString& MapName, uint32 LayoutHash);
+
+    /** Replays the log into memory, truncating any corrupt tail. */
+    void LoadLog();
+
+    /** Frames, checksums and durably appends a record. */
+    bool AppendToLog(const FLeaderboardRecord& Record);
+
+    FString GetLogPath() const;
+
+    /** Every persisted record, in log order. Boards index into this. */
+    TArray<FLeaderboardRecord> Records;
+
+    /** Board key (map + layout) -> board. */
+    TMap<FString, FBoard> Boards;
+
+    /** Maps with at least one record. */
+    TSet<FString> KnownMaps;
+
+    uint64 NextRecordId = 1;
+
+    /** Kept open for appending for the lifetime of the store. */
+    TUniquePtr<IFileHandle> LogHandle;
+};
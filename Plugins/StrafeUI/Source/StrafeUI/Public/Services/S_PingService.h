@@ -0,0 +1,109 @@
+// Plugins/StrafeUI/Source/StrafeUI/Public/Services/S_PingService.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "S_PingService.generated.h"
+
+/** How US_PingService measures a host. */
+UENUM()
+enum class E_PingProbeMode : uint8
+{
+    /** ICMP echo to the server's address. */
+    Icmp,
+    /**
+     * No network traffic: every host answers after a fixed, host-derived latency.
+     * For exercising the browser (concurrency, caching, live row updates) without real servers.
+     */
+    Loopback
+};
+
+/** Native notification that a host answered a probe. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnServerPingMeasured, const FString& /*HostAddress*/, int32 /*PingMs*/);
+
+/**
+ * Measures round-trip times to game servers for the server browser.
+ *
+ * The ping an online subsystem reports with a search result is often stale, or missing entirely for dedicated
+ * servers. Hosts queued here are probed concurrently, with at most MaxPingsInFlight probes outstanding, and every
+ * answer is broadcast through OnPingMeasured as it arrives.
+ *
+ * Answers are kept in a small cache persisted to Saved/ServerBrowser, so a host measured within PingCacheTTLSeconds
+ * has its ping available the moment the browser opens again, without being probed.
+ */
+UCLASS(Config = Game)
+class STRAFEUI_API US_PingService : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Returns true and the cached ping if HostAddress was measured within the TTL. */
+    bool GetCachedPing(const FString& HostAddress, int32& OutPingMs) const;
+
+    /** Queues a probe of HostAddress. Hosts already queued or being probed are ignored. */
+    void RequestPing(const FString& HostAddress);
+
+    /** Drops every queued probe. Probes already in flight still complete and are cached. */
+    void CancelPendingPings();
+
+    int32 GetNumPingsInFlight() const { return NumInFlight; }
+    int32 GetNumPingsQueued() const { return QueuedHosts.Num() - QueueHead; }
+
+    /** Broadcast on the game thread for every successful probe. */
+    FOnServerPingMeasured OnPingMeasured;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Ping")
+    E_PingProbeMode ProbeMode = E_PingProbeMode::Icmp;
+
+    /** Upper bound on probes outstanding at once. */
+    UPROPERTY(Config, EditAnywhere, Category = "Ping", meta = (ClampMin = "1", ClampMax = "128"))
+    int32 MaxPingsInFlight = 16;
+
+    /** A host that hasn't answered within this time is considered unreachable. */
+    UPROPERTY(Config, EditAnywhere, Category = "Ping", meta = (ClampMin = "0.1"))
+    float PingTimeoutSeconds = 1.5f;
+
+    /** How long a measured ping is trusted, across sessions. */
+    UPROPERTY(Config, EditAnywhere, Category = "Ping", meta = (ClampMin = "0"))
+    int32 PingCacheTTLSeconds = 600;
+
+private:
+    struct FCachedPing
+    {
+        int32 PingMs = 0;
+        /** Unix timestamp (seconds) of the measurement. */
+        int64 MeasuredAt = 0;
+    };
+
+    /** Starts queued probes until MaxPingsInFlight are outstanding. */
+    void PumpQueue();
+
+    void StartProbe(const FString& HostAddress);
+
+    /** Completion of a probe; PingMs is INDEX_NONE when the host did not answer. */
+    void HandleProbeResult(const FString& HostAddress, int32 PingMs);
+
+    void LoadCache();
+    void SaveCache();
+
+    static FString GetCachePath();
+
+    /** Hosts waiting for a probe slot. Consumed from QueueHead; compacted when it empties. */
+    TArray<FString> QueuedHosts;
+    int32 QueueHead = 0;
+
+    /** Hosts queued or in flight, so a host is never probed twice at the same time. */
+    TSet<FString> RequestedHosts;
+
+    int32 NumInFlight = 0;
+
+    /** HostAddress -> last measurement. */
+    TMap<FString, FCachedPing> PingCache;
+
+    /** Set when PingCache has measurements that are not on disk yet. */
+    bool bCacheDirty = false;
+};
@@ -0,0 +1,79 @@
+// Plugins/StrafeUI/Source/StrafeUI/Public/Services/S_ReplayCatalog.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Services/S_ReplayService.h"
+#include "S_ReplayCatalog.generated.h"
+
+/**
+ * Persistent index of the local replays in Saved/Demos.
+ *
+ * The catalog file (Saved/Demos/ReplayCatalog.bin) holds the metadata of every replay: map, mode, duration,
+ * player count, size and timestamp. It is read once when the game instance starts and rewritten whenever a
+ * replay is added or deleted through US_ReplayService, so listing replays never touches the replay files.
+ *
+ * Replays copied in or removed by hand are picked up by comparing the directory's modification time with
+ * the one stored in the catalog: one stat per listing. Only when it differs is the directory rescanned, and
+ * only files the catalog doesn't know are stat'ed. Those have no recorded metadata beyond size and date.
+ */
+UCLASS()
+class STRAFEUI_API US_ReplayCatalog : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Every known replay, newest first. Rescans first if the directory changed behind the catalog's back. */
+    const TArray<FReplayInfo>& GetReplays();
+
+    /** Returns the catalog entry for a replay, or nullptr. */
+    const FReplayInfo* FindReplay(const FString& ReplayName) const;
+
+    /**
+     * Adds or updates a replay that just finished recording. Size and timestamp are read from the file if not set.
+     * Call after the file is closed.
+     */
+    void AddReplay(FReplayInfo Info);
+
+    /**
+     * Adds a replay whose recording was just stopped. The replay streamer finalizes the file asynchronously, so the
+     * entry stays pending and its size and timestamp are re-read on each GetReplays until they stop changing.
+     */
+    void AddPendingReplay(FReplayInfo Info);
+
+    /** Forgets a replay whose file was deleted. */
+    void RemoveReplay(const FString& ReplayName);
+
+    /** Directory holding the replays and the catalog. */
+    static FString GetReplayDirectory();
+
+private:
+    /** Cheap check: has anything been added, removed or renamed in the directory since the catalog was written? */
+    bool HasDirectoryChanged() const;
+
+    /** Reconciles the catalog with the files on disk. Only unknown files are stat'ed. */
+    void Rescan();
+
+    /** Re-stats the pending replays and settles those whose file size did not change since the last look. */
+    void RefreshPendingReplays();
+
+    void SortReplays();
+
+    void LoadCatalog();
+    void SaveCatalog();
+
+    static FString GetCatalogPath();
+
+    /** Newest first. */
+    TArray<FReplayInfo> Replays;
+
+    /** Modification time of the replay directory when the catalog last matched it. */
+    FDateTime DirectoryTimestamp;
+
+    /** Replays added by AddPendingReplay that may still be written, with the file size last seen (-1 before the first look). */
+    TMap<FString, int64> PendingReplaySizes;
+};
@@ -23,15 +23,51 @@ struct FReplayInfo
     UPROPERTY(BlueprintReadOnly)
     int32 FileSizeKB;
 
+    /** Map the replay was recorded on. Empty for replays the catalog found on disk rather than recorded. */
+    UPROPERTY(BlueprintReadOnly)
+    FString MapName;
+
+    UPROPERTY(BlueprintReadOnly)
+    FString GameMode;
+
+    UPROPERTY(BlueprintReadOnly)
+    float DurationSeconds;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 NumPlayers;
+
     FReplayInfo()
     {
         FileSizeKB = 0;
         Timestamp = FDateTime::Now();
+        DurationSeconds = 0.0f;
+        NumPlayers = 0;
     }
 };
 
 /**
- * Service for managing local replay files
+ * How a replay is recorded
+ */
+USTRUCT(BlueprintType)
+struct FReplayRecordingSettings
+{
+    GENERATED_BODY()
+
+    /**
+     * Seconds between keyframe checkpoints. A seek restores the checkpoint before the target and fast-forwards
+     * from there, so this bounds how much of the stream a seek has to simulate.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1.0"))
+    float CheckpointIntervalSeconds = 5.0f;
+
+    /** Oodle-compress the stream. Compression runs on the replay streamer's worker tasks. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    bool bCompress = true;
+};
+
+/**
+ * Service for managing local replay files.
+ * Listings come from US_ReplayCatalog; the replay files themselves are only touched to play or delete them.
  */
 UCLASS()
 class STRAFEUI_API US_ReplayService : public UObject
@@ -53,6 +89,39 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Replay")
     void PlayReplay(const FString& ReplayName, APlayerController* PC);
 
+    /**
+     * Starts recording the current match
+     * @param ReplayName The name of the replay file (without extension)
+     * @param Settings Checkpoint interval and compression
+     * @return False if a recording could not be started
+     */
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool StartRecording(const FString& ReplayName, const FReplayRecordingSettings& Settings);
+
+    /** Stops the recording started by StartRecording, restores the checkpoint interval and adds it to the replay catalog */
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    void StopRecording();
+
+    /**
+     * Moves playback of the running replay to a time. While a seek is in progress, further requests are coalesced
+     * and only the latest one runs when it finishes, so dragging a scrub bar never queues up seeks.
+     * @param TimeSeconds Target time from the start of the replay; clamped to its length
+     * @param OnComplete Optional callback receiving whether the seek succeeded; dropped if a later request replaces this one
+     * @return False if no replay is playing
+     */
+    bool SeekReplay(float TimeSeconds, TFunction<void(bool)> OnComplete = nullptr);
+
+    /** Current playback time of the running replay, in seconds */
+    UFUNCTION(BlueprintPure, Category = "Replay")
+    float GetReplayCurrentTime() const;
+
+    /** Length of the running replay, in seconds */
+    UFUNCTION(BlueprintPure, Category = "Replay")
+    float GetReplayTotalTime() const;
+
+    UFUNCTION(BlueprintPure, Category = "Replay")
+    bool IsPlayingReplay() const;
+
     /**
      * Deletes a replay file
      * @param ReplayName The name of the replay to delete (without extension)
@@ -60,10 +129,42 @@ public:
      */
     void DeleteReplay(const FString& ReplayName, TFunction<void(bool)> OnComplete);
 
+    /**
+     * Adds a replay that just finished recording to the catalog, with the metadata only the game knows.
+     * The file is still being finalized, so the catalog keeps it pending and re-reads its size and timestamp.
+     * @param Info FileName (without extension) and metadata
+     */
+    void RegisterRecordedReplay(const FReplayInfo& Info);
+
 private:
     /** Gets the replay directory path */
     FString GetReplayDirectory() const;
 
+    /** Resolves the replay catalog from the owning game instance. */
+    class US_ReplayCatalog* GetCatalog() const;
+
+    /** The demo driver of the replay currently playing, or nullptr */
+    class UDemoNetDriver* GetPlayingDemoDriver() const;
+
+    /** Starts the seek to PendingSeekTime */
+    void RunPendingSeek();
+
+    /** Streamer options for recording and playback; compressed replays need the compressing streamer to play */
+    static TArray<FString> MakeStreamerOptions(bool bCompress);
+
+    /** Replay being recorded by StartRecording, empty if none */
+    FString RecordingReplayName;
+
+    /** demo.CheckpointUploadDelayInSeconds before StartRecording changed it; the cvar is process-wide */
+    float SavedCheckpointUploadDelay = 0.0f;
+    bool bCheckpointUploadDelayOverridden = false;
+
+    /** Seek coalescing state */
+    bool bSeekInProgress = false;
+    bool bHasPendingSeek = false;
+    float PendingSeekTime = 0.0f;
+    TFunction<void(bool)> PendingSeekCallback;
+
     /** Timer handle for async operations */
     FTimerHandle AsyncOperationTimer;
 };
\ No newline at end of file
@@ -37,6 +37,9 @@ private:
     UFUNCTION()
     void OnServerListUpdated();
 
+    /** Called when streamed search results were appended to the ViewModel's filtered list. */
+    void OnServerEntriesAppended(int32 FirstFilteredIndex, int32 Count);
+
     /** Called when the user clicks on an item in the server list. */
     UFUNCTION()
     void OnServerSelected(UObject* Item);
@@ -26,6 +26,9 @@ public:
 
     virtual US_UI_ViewModelBase* CreateViewModel() override;
 
+    /** The ViewModel currently shown, for the list's entry widgets */
+    US_UI_VM_Leaderboards* GetViewModel() const;
+
 protected:
     virtual void NativeOnInitialized() override;
 
@@ -46,6 +49,23 @@ private:
     UFUNCTION()
     void OnBackClicked();
 
+    /** Called when the find-me button is clicked */
+    UFUNCTION()
+    void OnFindMeClicked();
+
+    /** Loads the neighbouring page when the list scrolls near either end of the loaded window */
+    UFUNCTION()
+    void OnLeaderboardScrolled(float ItemOffset, float DistanceRemaining);
+
+    /** Keeps the rows on screen in place when rows are inserted or released above them */
+    void OnWindowShifted(int32 RowsAddedAtFront);
+
+    /** Scrolls to the focus row of a new window */
+    void OnWindowReset(int32 FocusIndex);
+
+    /** Rows from either end of the window at which the next page is requested */
+    static constexpr int32 PageLoadThresholdRows = 10;
+
     /** The ViewModel that provides data for this widget */
     UPROPERTY()
     TWeakObjectPtr<US_UI_VM_Leaderboards> ViewModel;
@@ -65,4 +85,7 @@ private:
 
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UCommonButtonBase> Btn_Back;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UCommonButtonBase> Btn_FindMe;
 };
\ No newline at end of file
@@ -22,6 +22,7 @@ class STRAFEUI_API US_UI_ServerListEntry : public UCommonUserWidget, public IUse
 public:
     // IUserObjectListEntry interface
     virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+    virtual void NativeOnEntryReleased() override;
     // End of IUserObjectListEntry interface
 
 protected:
@@ -31,6 +32,12 @@ private:
     /** Updates the visual state based on server capacity */
     void UpdateServerStatusVisuals();
 
+    /** Updates the ping text and icon; also called when the ping is re-measured while the row is visible */
+    void UpdatePingVisuals();
+
+    /** Stops listening to the entry this row showed before */
+    void UnbindServerData();
+
     /** Formats the player count text */
     FText GetPlayerCountText(int32 CurrentPlayers, int32 MaxPlayers) const;
 
@@ -71,4 +78,6 @@ private:
     // Cached server data
     UPROPERTY()
     TWeakObjectPtr<class US_UI_VM_ServerListEntry> CachedServerData;
+
+    FDelegateHandle PingUpdatedHandle;
 };
\ No newline at end of file
@@ -7,8 +7,15 @@
 #include "Services/S_LeaderboardService.h"
 #include "S_UI_VM_Leaderboards.generated.h"
 
+/** Native notification that rows were inserted at (positive) or released from (negative) the front of LeaderboardEntries. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLeaderboardWindowShifted, int32 /*RowsAddedAtFront*/);
+
+/** Native notification that the window was replaced; FocusIndex is the row the list should bring into view. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLeaderboardWindowReset, int32 /*FocusIndex*/);
+
 /**
- * ViewModel entry for leaderboard list items
+ * ViewModel entry for leaderboard list items.
+ * Entries are pooled by US_UI_VM_Leaderboards and re-filled when the visible window moves.
  */
 UCLASS()
 class STRAFEUI_API US_UI_VM_LeaderboardEntry : public UObject
@@ -28,12 +35,34 @@ public:
     UPROPERTY(BlueprintReadOnly)
     float Time;
 
-    UPROPERTY(BlueprintReadOnly)
-    FString FormattedTime;
+    /** Store record id of the time shown */
+    uint64 RecordId = 0;
+
+    /** Time as MM:SS.cc. Blueprint reads go through GetFormattedTime, so rows that are never shown are never formatted. */
+    UPROPERTY(BlueprintReadOnly, BlueprintGetter = GetFormattedTime)
+    mutable FString FormattedTime;
+
+    /** Formats the time on first read and caches it until the entry is re-filled */
+    UFUNCTION(BlueprintGetter)
+    FString GetFormattedTime() const;
+
+    /** Re-fills this entry with another row */
+    void SetFromEntry(const FLeaderboardEntry& Entry);
+
+    /** Formats time in seconds to MM:SS.MS format */
+    static FString FormatTime(float TimeInSeconds);
+
+private:
+    mutable bool bFormattedTimeValid = false;
 };
 
 /**
- * ViewModel for the Leaderboards screen
+ * ViewModel for the Leaderboards screen.
+ *
+ * Holds a contiguous window of the selected board rather than the whole board: the window starts as one page
+ * (at the top, or around the local player) and moves a page at a time as the list scrolls towards either end,
+ * releasing rows at the far end once it holds MaxWindowPages pages. Entry objects are pooled across refreshes
+ * and map changes.
  */
 UCLASS(BlueprintType)
 class STRAFEUI_API US_UI_VM_Leaderboards : public US_UI_ViewModelBase
@@ -49,10 +78,28 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Leaderboards")
     void SetMapFilter(const FString& NewMapName);
 
-    /** Refreshes the leaderboard data */
+    /** Refreshes the map list and the leaderboard data, starting again from the top of the board */
     UFUNCTION(BlueprintCallable, Category = "Leaderboards")
     void RefreshLeaderboard();
 
+    /** Replaces the window with a page centred on the local player's time (or the top if they have none) */
+    UFUNCTION(BlueprintCallable, Category = "Leaderboards")
+    void ShowAroundLocalPlayer();
+
+    /** Appends the page after the window, trimming its start if needed. Returns false if the window already reaches the end of the board. */
+    UFUNCTION(BlueprintCallable, Category = "Leaderboards")
+    bool LoadNextPage();
+
+    /** Prepends the page before the window, trimming its end if needed. Returns false if the window already starts at rank 1. */
+    UFUNCTION(BlueprintCallable, Category = "Leaderboards")
+    bool LoadPreviousPage();
+
+    UFUNCTION(BlueprintPure, Category = "Leaderboards")
+    bool HasNextPage() const { return WindowFirstRank + LeaderboardEntries.Num() <= TotalEntries; }
+
+    UFUNCTION(BlueprintPure, Category = "Leaderboards")
+    bool HasPreviousPage() const { return WindowFirstRank > 1; }
+
     /** Placeholder function to simulate playing a replay */
     UFUNCTION(BlueprintCallable, Category = "Leaderboards")
     void PlayReplayForEntry(UObject* EntryObject);
@@ -73,11 +120,49 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Leaderboards")
     bool bIsLoading;
 
+    /** Rank of LeaderboardEntries[0] */
+    UPROPERTY(BlueprintReadOnly, Category = "Leaderboards")
+    int32 WindowFirstRank = 1;
+
+    /** Number of ranked players on the selected board */
+    UPROPERTY(BlueprintReadOnly, Category = "Leaderboards")
+    int32 TotalEntries = 0;
+
+    /** Rows fetched per page */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Leaderboards")
+    int32 PageSize = 50;
+
+    /** Pages kept in the window; rows beyond that are released from the end away from the page just loaded */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Leaderboards", meta = (ClampMin = "2"))
+    int32 MaxWindowPages = 3;
+
+    /** Broadcast after OnDataChanged when paging added or released rows above the ones already shown */
+    FOnLeaderboardWindowShifted OnWindowShifted;
+
+    /** Broadcast after OnDataChanged when RefreshLeaderboard or ShowAroundLocalPlayer replaced the window */
+    FOnLeaderboardWindowReset OnWindowReset;
+
 private:
+    /** Replaces the window with a page */
+    void ShowPage(FLeaderboardPage Page);
+
+    /** Takes an entry from the pool, or creates one */
+    US_UI_VM_LeaderboardEntry* AcquireEntry(const FLeaderboardEntry& Entry);
+
+    /** Returns every entry of the window to the pool */
+    void ReleaseWindow();
+
+    /** Returns the rows beyond MaxWindowPages pages to the pool, from the front or the back. Returns the number released. */
+    int32 TrimWindow(bool bFromFront);
+
+    /** Same identity the race manager submits times under: unique net id, or the name when offline */
+    FString GetLocalPlayerId() const;
+
     /** Cached leaderboard service */
     UPROPERTY()
     TObjectPtr<US_LeaderboardService> LeaderboardService;
 
-    /** Formats time in seconds to MM:SS.MS format */
-    FString FormatTime(float TimeInSeconds) const;
+    /** Entries not in the window, ready for reuse */
+    UPROPERTY()
+    TArray<TObjectPtr<US_UI_VM_LeaderboardEntry>> EntryPool;
 };
\ No newline at end of file
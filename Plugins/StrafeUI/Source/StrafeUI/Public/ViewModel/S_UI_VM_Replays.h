@@ -30,6 +30,18 @@ public:
 
     UPROPERTY(BlueprintReadOnly)
     int32 FileSizeKB;
+
+    UPROPERTY(BlueprintReadOnly)
+    FString MapName;
+
+    UPROPERTY(BlueprintReadOnly)
+    FString GameMode;
+
+    UPROPERTY(BlueprintReadOnly)
+    float DurationSeconds;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 NumPlayers;
 };
 
 /**
@@ -56,6 +68,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Replays")
     void DeleteSelectedReplay();
 
+    /** Seeks the replay that is playing; rapid calls (e.g. dragging a scrub bar) are coalesced */
+    UFUNCTION(BlueprintCallable, Category = "Replays")
+    void SeekReplay(float TimeSeconds);
+
+    /** Seeks to a fraction (0-1) of the replay that is playing */
+    UFUNCTION(BlueprintCallable, Category = "Replays")
+    void SeekReplayToFraction(float Fraction);
+
+    /** Current playback time of the replay that is playing, in seconds */
+    UFUNCTION(BlueprintPure, Category = "Replays")
+    float GetPlaybackTime() const;
+
+    /** Length of the replay that is playing, in seconds */
+    UFUNCTION(BlueprintPure, Category = "Replays")
+    float GetPlaybackLength() const;
+
+    /** Whether a seek is waiting for the replay to catch up */
+    UPROPERTY(BlueprintReadOnly, Category = "Replays")
+    bool bIsSeeking;
+
     /** Sets the selected replay */
     UFUNCTION(BlueprintCallable, Category = "Replays")
     void SetSelectedReplay(UObject* ReplayEntry);
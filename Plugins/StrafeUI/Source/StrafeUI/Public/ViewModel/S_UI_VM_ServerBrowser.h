@@ -5,10 +5,12 @@
 #include "CoreMinimal.h"
 #include "ViewModel/S_UI_ViewModelBase.h"
 #include "OnlineSessionSettings.h"
+#include "Containers/Ticker.h"
 #include "StrafeMultiplayer/Public/MultiplayerSessionTypes.h"
 #include "S_UI_VM_ServerBrowser.generated.h"
 
 class UStrafeMultiplayerSubsystem;
+class US_PingService;
 
 /**
  * @struct F_ServerInfo
@@ -63,13 +65,31 @@ public:
 
 	/** The full session search result needed for joining */
 	FOnlineSessionSearchResult SessionSearchResult;
+
+	/** Native notification for the row showing this entry that ServerInfo.Ping was re-measured */
+	FSimpleMulticastDelegate OnPingUpdated;
+};
+
+/** Order of the filtered server list. */
+UENUM(BlueprintType)
+enum class E_ServerBrowserSort : uint8
+{
+	Arrival		UMETA(DisplayName = "As Found"),
+	Ping		UMETA(DisplayName = "Ping"),
+	Players		UMETA(DisplayName = "Players")
 };
 
+/** Native notification that entries were appended to the filtered list without anything else changing. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnServerEntriesAppended, int32 /*FirstFilteredIndex*/, int32 /*Count*/);
+
 /**
  * @class US_UI_VM_ServerBrowser
  * @brief ViewModel for the Server Browser screen.
  *
  * Manages the list of servers and handles refresh requests.
+ * Search results stream in while the search is still running and are converted a chunk per frame,
+ * so the first rows appear almost immediately and a 10000-server search never stalls a frame.
+ * Entry objects are pooled across refreshes.
  */
 UCLASS(BlueprintType)
 class STRAFEUI_API US_UI_VM_ServerBrowser : public US_UI_ViewModelBase
@@ -126,31 +146,166 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Server Browser|Filters")
 	bool bSearchLAN = false;
 
-	/** Apply current filters and refresh the displayed list */
+	/** Ping sorts lowest first, players sorts fullest first. */
+	UPROPERTY(BlueprintReadWrite, Category = "Server Browser|Filters")
+	E_ServerBrowserSort SortMode = E_ServerBrowserSort::Arrival;
+
+	/** Filter changes within this many seconds of each other are applied once, after the last one. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Server Browser|Filters")
+	float FilterDebounceSeconds = 0.15f;
+
+	/**
+	 * Apply current filters and refresh the displayed list.
+	 * Debounced by FilterDebounceSeconds unless bImmediate, so it can be called on every keystroke.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Server Browser")
-	void ApplyFilters();
+	void ApplyFilters(bool bImmediate = false);
+
+	/** Entries passing the current filters, in the same order as ServerList. Feed these to the list view as-is. */
+	const TArray<TObjectPtr<US_UI_VM_ServerListEntry>>& GetFilteredEntries() const { return FilteredEntries; }
+
+	/** True while a search is running or results are still being converted. */
+	UFUNCTION(BlueprintPure, Category = "Server Browser")
+	bool IsSearching() const { return ActiveSearches > 0 || PendingResultIndex < PendingResults.Num(); }
+
+	/** Broadcast after each streamed chunk. OnDataChanged is only broadcast when the whole list is rebuilt. */
+	FOnServerEntriesAppended OnEntriesAppended;
+
+	/** How many search results are turned into entries per frame while streaming. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Server Browser")
+	int32 MaxEntriesPerFrame = 250;
+
+	/** Re-measure server pings with US_PingService instead of trusting the ping reported by the search. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Server Browser")
+	bool bProbeServerPings = true;
 
 	// Friend class to allow FindGameWidget to access AllFoundServers
 	friend class US_UI_FindGameWidget;
 
+protected:
+	virtual void BeginDestroy() override;
+
 private:
-	/** Callback for when session search completes */
-	void OnFindSessionsComplete(const TArray<FOnlineSessionSearchResult>& SessionResults, EMultiplayerSessionResult Result);
+	/** Callbacks for when each session search completes */
+	void OnFindLobbiesComplete(const TArray<FOnlineSessionSearchResult>& SessionResults, EMultiplayerSessionResult Result);
+	void OnFindDedicatedServersComplete(const TArray<FOnlineSessionSearchResult>& SessionResults, EMultiplayerSessionResult Result);
+
+	/** Callback for partial results while a search is still running */
+	void OnFindSessionsProgress(const TArray<FOnlineSessionSearchResult>& SearchResultsSoFar, bool bDedicatedSearch);
+
+	/** Queues the results of one search we haven't seen yet. Results arrive cumulatively, so only the tail is new. */
+	void EnqueueResults(const TArray<FOnlineSessionSearchResult>& SearchResultsSoFar, bool bDedicatedSearch);
+
+	void OnSearchFinished(EMultiplayerSessionResult Result);
+
+	/** Converts up to MaxEntriesPerFrame pending results into entries. Ticker callback; returns false when drained. */
+	bool ProcessPendingResults(float DeltaTime);
+
+	/** Takes an entry from the pool, or creates one. */
+	US_UI_VM_ServerListEntry* AcquireEntry();
+
+	static void FillServerInfo(F_ServerInfo& ServerInfo, const FOnlineSessionSearchResult& SearchResult);
+
+	void ShowNoServersModal();
 
 	/** Callback for when join session completes */
 	void OnJoinSessionComplete(EMultiplayerSessionResult Result, const FString& ConnectString);
 
+	/** Applies a cached ping to a new entry, or queues a probe for it. */
+	void RequestEntryPing(int32 ServerIndex);
+
+	/** Pushes a measured ping into every entry on that host and refreshes the list if it changes order or filtering. */
+	void OnServerPingMeasured(const FString& HostAddress, int32 PingMs);
+
+	/** IP address of a search result's game server, or empty if it has none (e.g. a Steam P2P lobby). */
+	FString ResolvePingHost(const FOnlineSessionSearchResult& SearchResult) const;
+
 	/** Cached list of all found servers before filtering */
 	UPROPERTY()
 	TArray<TObjectPtr<US_UI_VM_ServerListEntry>> AllFoundServers;
 
+	/** The subset of AllFoundServers shown, parallel to ServerList */
+	UPROPERTY()
+	TArray<TObjectPtr<US_UI_VM_ServerListEntry>> FilteredEntries;
+
+	/** Entries from previous refreshes, ready for reuse */
+	UPROPERTY()
+	TArray<TObjectPtr<US_UI_VM_ServerListEntry>> EntryPool;
+
+	/** Results received but not yet converted, consumed from PendingResultIndex */
+	TArray<FOnlineSessionSearchResult> PendingResults;
+	int32 PendingResultIndex = 0;
+
+	/** How many results of each search have been queued */
+	int32 QueuedLobbyResults = 0;
+	int32 QueuedDedicatedResults = 0;
+
+	/** Searches started by the last refresh that haven't reported completion */
+	int32 ActiveSearches = 0;
+
+	FTSTicker::FDelegateHandle ProcessTickerHandle;
+
 	/** Reference to the multiplayer subsystem */
 	UPROPERTY()
 	TObjectPtr<UStrafeMultiplayerSubsystem> MultiplayerSubsystem;
 
+	UPROPERTY()
+	TObjectPtr<US_PingService> PingService;
+
+	/** Host address -> AllFoundServers indices waiting for or showing its ping */
+	TMap<FString, TArray<int32, TInlineAllocator<1>>> ServersByPingHost;
+
 	/** Updates the visible server list based on current filters */
 	void UpdateFilteredServerList();
 
-	/** Checks if a server passes the current filter criteria */
-	bool PassesFilters(const TObjectPtr<US_UI_VM_ServerListEntry>& Entry) const;
+	/** Checks if the server at this AllFoundServers index passes the current filter criteria */
+	bool PassesFilters(int32 ServerIndex) const;
+
+	/** Search data for one entry of AllFoundServers, built once when the entry is added. */
+	struct FServerSearchIndexEntry
+	{
+		FString LowerServerName;
+		FString LowerGameMode;
+		/** Characters present in each string; a query needing a character that isn't there can't match. */
+		uint64 ServerNameCharMask = 0;
+		uint64 GameModeCharMask = 0;
+	};
+
+	/** A lower-cased word of a text filter. Every word has to appear in the field. */
+	struct FSearchToken
+	{
+		FString Text;
+		uint64 CharMask = 0;
+	};
+
+	/** Adds AllFoundServers[ServerIndex] to the search index, flag bitsets and (lazily) the sort orders. */
+	void IndexServer(int32 ServerIndex);
+
+	/** Lower-cases and tokenizes the text filters once per filter pass. */
+	void PrepareFilterTokens();
+
+	static uint64 MakeCharMask(const FString& LowerText);
+	static bool MatchesTokens(const FString& LowerText, uint64 TextCharMask, const TArray<FSearchToken>& Tokens);
+
+	/** Debounce ticker callback. */
+	bool HandleFilterDebounce(float DeltaTime);
+
+	/** Parallel to AllFoundServers. */
+	TArray<FServerSearchIndexEntry> SearchIndex;
+
+	/** One bit per AllFoundServers entry, set where the server may be shown under the matching hide-filter. */
+	TBitArray<> NotFullBits;
+	TBitArray<> NotEmptyBits;
+	TBitArray<> PublicBits;
+
+	/** AllFoundServers indices by ascending ping and by descending player count; rebuilt when new entries arrive. */
+	TArray<int32> PingOrder;
+	TArray<int32> PlayerOrder;
+	bool bSortOrdersDirty = false;
+
+	/** Text filters of the current pass. */
+	TArray<FSearchToken> ServerNameTokens;
+	TArray<FSearchToken> GameModeTokens;
+
+	FTSTicker::FDelegateHandle FilterDebounceHandle;
 };
\ No newline at end of file
@@ -50,7 +50,10 @@ public class StrafeUI : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
-                "RenderCore"
+                "RenderCore",
+                "Icmp",
+                "Sockets",
+                "StrafeReplayStreaming"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -20,6 +20,10 @@ AS_ArenaGameMode::AS_ArenaGameMode()
     FragLimit = 20;
     WarmupTime = 15.0f;
     PostMatchTime = 20.0f;
+
+    // Keep clients connected between matches; PlayerStates carry over through CopyProperties.
+    // Note that PIE only honours this with net.AllowPIESeamlessTravel enabled.
+    bUseSeamlessTravel = true;
 }
 
 void AS_ArenaGameMode::InitGameState()
@@ -127,6 +131,18 @@ void AS_ArenaGameMode::HandleMatchHasStarted()
         ArenaGS->SetMatchStateNameOverride(NAME_None);
     }
 
+    // Scores carried over by seamless travel stay on the scoreboard through warmup; the new match starts clean.
+    if (GameState)
+    {
+        for (APlayerState* PS : GameState->PlayerArray)
+        {
+            if (AS_ArenaPlayerState* ArenaPS = Cast<AS_ArenaPlayerState>(PS))
+            {
+                ArenaPS->ServerResetScore();
+            }
+        }
+    }
+
     for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
     {
         APlayerController* PC = It->Get();
@@ -142,30 +158,18 @@ void AS_ArenaGameMode::StartMainMatchTimer()
 {
     if (MatchTimeLimitSeconds > 0)
     {
-        GetWorldTimerManager().SetTimer(MatchTimerHandle, this, &AS_ArenaGameMode::UpdateMainMatchTime, 1.0f, true);
+        GetWorldTimerManager().SetTimer(MatchTimerHandle, this, &AS_ArenaGameMode::OnMatchTimerEnd, MatchTimeLimitSeconds, false);
         UE_LOG(LogTemp, Log, TEXT("AS_ArenaGameMode: Main match timer started for %d seconds."), MatchTimeLimitSeconds);
     }
 }
 
-void AS_ArenaGameMode::UpdateMainMatchTime()
+void AS_ArenaGameMode::OnMatchTimerEnd()
 {
-    AS_ArenaGameState* ArenaGS = GetArenaGameState();
-    if (ArenaGS && IsMatchInProgress())
-    {
-        int32 CurrentTime = ArenaGS->RemainingTime;
-        CurrentTime--;
-        ArenaGS->SetRemainingTime(CurrentTime);
-
-        if (CurrentTime <= 0 && MatchTimeLimitSeconds > 0) // Ensure time limit was set
-        {
-            UE_LOG(LogTemp, Log, TEXT("AS_ArenaGameMode: Match time limit reached."));
-            GetWorldTimerManager().ClearTimer(MatchTimerHandle);
-            EndMatch();
-        }
-    }
-    else if (IsMatchInProgress()) // Should not happen if ArenaGS is null, but safety
+    // Clients count down locally from the replicated phase end time; the server only needs to act here.
+    if (IsMatchInProgress())
     {
-        GetWorldTimerManager().ClearTimer(MatchTimerHandle);
+        UE_LOG(LogTemp, Log, TEXT("AS_ArenaGameMode: Match time limit reached."));
+        EndMatch();
     }
 }
 
@@ -211,8 +215,8 @@ void AS_ArenaGameMode::StartPostMatchTimer()
 void AS_ArenaGameMode::OnPostMatchTimerEnd()
 {
     GetWorldTimerManager().ClearTimer(PostMatchTimerHandle);
-    UE_LOG(LogTemp, Log, TEXT("AS_ArenaGameMode: Post-match ended. Restarting game or returning to lobby."));
-    RestartGame(); // Or specific logic like TravelToMap
+    UE_LOG(LogTemp, Log, TEXT("AS_ArenaGameMode: Post-match ended. Travelling to the next map."));
+    TravelToNextMap();
 }
 
 
@@ -307,7 +311,7 @@ void AS_ArenaGameMode::CheckMatchEndConditions()
             }
         }
     }
-    // Time limit is checked by UpdateMainMatchTime
+    // Time limit is enforced by the one-shot MatchTimerHandle
 }
 
 AS_ArenaPlayerState* AS_ArenaGameMode::GetMatchWinner() const
@@ -19,6 +19,10 @@ void AS_ArenaPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 
 void AS_ArenaPlayerState::Reset()
 {
+    if (bPreservingStateForTravel)
+    {
+        return;
+    }
     Super::Reset(); // Calls base class Reset (handles bIsDead, core GAS re-init if any)
 
     // Reset Arena-specific scores
@@ -35,17 +39,13 @@ void AS_ArenaPlayerState::CopyProperties(APlayerState* InPlayerState)
 {
     Super::CopyProperties(InPlayerState);
 
-    AS_ArenaPlayerState* SourceArenaPS = Cast<AS_ArenaPlayerState>(InPlayerState);
-    if (SourceArenaPS)
+    // Copy from this (outgoing) PlayerState into the new one. Only on server, replication will handle clients.
+    AS_ArenaPlayerState* TargetArenaPS = Cast<AS_ArenaPlayerState>(InPlayerState);
+    if (TargetArenaPS && HasAuthority())
     {
-        // Only copy if on server, replication will handle clients
-        if (HasAuthority())
-        {
-            this->Frags = SourceArenaPS->Frags;
-            this->Deaths = SourceArenaPS->Deaths;
-            // Broadcast update if values actually changed, or let replication handle it.
-            // Since this is a direct copy, usually just setting the values is enough, replication handles the rest.
-        }
+        TargetArenaPS->Frags = Frags;
+        TargetArenaPS->Deaths = Deaths;
+        TargetArenaPS->BroadcastArenaScoreUpdate();
     }
 }
 
@@ -6,6 +6,7 @@
 #include "TimerManager.h"           // For FTimerManager
 #include "Engine/World.h"             // For GetWorld()
 #include "Kismet/GameplayStatics.h"   // For UGameplayStatics
+#include "Misc/PackageName.h"
 
 AS_GameModeBase::AS_GameModeBase()
 {
@@ -31,6 +32,48 @@ bool AS_GameModeBase::PlayerCanRestart(APlayerController* Player)
     return false;
 }
 
+void AS_GameModeBase::HandleSeamlessTravelPlayer(AController*& C)
+{
+    // The engine resets the old PlayerState before copying it into the new one.
+    if (AS_PlayerState* OldPlayerState = C ? C->GetPlayerState<AS_PlayerState>() : nullptr)
+    {
+        OldPlayerState->PrepareForSeamlessTravel();
+    }
+
+    Super::HandleSeamlessTravelPlayer(C);
+
+    // PostLogin is not called for players arriving by seamless travel.
+    InitializePlayer(Cast<APlayerController>(C));
+}
+
+void AS_GameModeBase::TravelToNextMap()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (MapRotation.Num() == 0)
+    {
+        RestartGame();
+        return;
+    }
+
+    const FString CurrentMap = UWorld::RemovePIEPrefix(World->GetOutermost()->GetName());
+    const int32 CurrentIndex = MapRotation.IndexOfByPredicate([&CurrentMap](const FString& Map)
+        {
+            return Map.Equals(CurrentMap, ESearchCase::IgnoreCase)
+                || FPackageName::GetShortName(Map).Equals(FPackageName::GetShortName(CurrentMap), ESearchCase::IgnoreCase);
+        });
+    const FString& NextMap = MapRotation[(CurrentIndex + 1) % MapRotation.Num()];
+
+    // Keep the same (possibly Blueprint) game mode on the next map.
+    const FString TravelURL = FString::Printf(TEXT("%s?game=%s"), *NextMap, *GetClass()->GetPathName());
+    UE_LOG(LogTemp, Log, TEXT("AS_GameModeBase::TravelToNextMap: Travelling to %s (seamless: %d)."), *TravelURL, bUseSeamlessTravel ? 1 : 0);
+    World->ServerTravel(TravelURL);
+}
+
 void AS_GameModeBase::InitGameState()
 {
     Super::InitGameState();
@@ -1,31 +1,80 @@
 #include "GameModes/S_GameStateBase.h"
 #include "Net/UnrealNetwork.h" // For DOREPLIFETIME
+#include "TimerManager.h"
+#include "Engine/World.h"
 
 AS_GameStateBase::AS_GameStateBase()
 {
     RemainingTime = 0;
+    PhaseEndServerTime = 0.0;
     // MaxPlayers = 16; // Example default
 }
 
 void AS_GameStateBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(AS_GameStateBase, RemainingTime);
+    DOREPLIFETIME(AS_GameStateBase, PhaseEndServerTime);
     // DOREPLIFETIME(AS_GameStateBase, MaxPlayers);
 }
 
-void AS_GameStateBase::OnRep_RemainingTime()
+void AS_GameStateBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    OnRemainingTimeChangedDelegate.Broadcast(RemainingTime);
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(CountdownTimerHandle);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void AS_GameStateBase::OnRep_PhaseEndServerTime()
+{
+    UpdateLocalCountdown();
 }
 
 void AS_GameStateBase::SetRemainingTime(int32 NewTime)
 {
     if (HasAuthority())
     {
-        RemainingTime = FMath::Max(0, NewTime);
-        // If called on server, OnRep will not fire automatically for the server itself.
-        // If server needs to react to this change immediately:
+        PhaseEndServerTime = NewTime > 0 ? GetServerWorldTimeSeconds() + NewTime : 0.0;
+        // OnRep does not fire on the server itself.
+        UpdateLocalCountdown();
+    }
+}
+
+float AS_GameStateBase::GetRemainingTimeSeconds() const
+{
+    if (PhaseEndServerTime <= 0.0)
+    {
+        return 0.0f;
+    }
+    return static_cast<float>(FMath::Max(0.0, PhaseEndServerTime - GetServerWorldTimeSeconds()));
+}
+
+void AS_GameStateBase::UpdateLocalCountdown()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const float Remaining = GetRemainingTimeSeconds();
+    const int32 NewRemainingTime = FMath::CeilToInt(Remaining);
+    if (NewRemainingTime != RemainingTime)
+    {
+        RemainingTime = NewRemainingTime;
         OnRemainingTimeChangedDelegate.Broadcast(RemainingTime);
     }
-}
\ No newline at end of file
+
+    if (Remaining > 0.0f)
+    {
+        // Wake up just after the next whole-second boundary. Re-evaluating against the server clock
+        // every time keeps the display in step as the client's clock offset gets refined.
+        const float UntilNextSecond = Remaining - (NewRemainingTime - 1);
+        World->GetTimerManager().SetTimer(CountdownTimerHandle, this, &AS_GameStateBase::UpdateLocalCountdown, FMath::Max(UntilNextSecond + KINDA_SMALL_NUMBER, 0.05f), false);
+    }
+    else
+    {
+        World->GetTimerManager().ClearTimer(CountdownTimerHandle);
+    }
+}
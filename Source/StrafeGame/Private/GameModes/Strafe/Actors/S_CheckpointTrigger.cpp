@@ -2,6 +2,9 @@
 #include "Components/BoxComponent.h"
 #include "Components/BillboardComponent.h"
 #include "Player/S_Character.h"
+#include "GameModes/Strafe/S_StrafeGameState.h"
+#include "GameModes/Strafe/S_StrafeManager.h"
+#include "Engine/World.h"
 
 AS_CheckpointTrigger::AS_CheckpointTrigger()
 {
@@ -30,6 +33,8 @@ AS_CheckpointTrigger::AS_CheckpointTrigger()
 
     CheckpointOrder = 0;
     TypeOfCheckpoint = ECheckpointType::Checkpoint;
+    SortedIndex = INDEX_NONE;
+    StageIndex = INDEX_NONE;
 }
 
 void AS_CheckpointTrigger::BeginPlay()
@@ -39,9 +44,32 @@ void AS_CheckpointTrigger::BeginPlay()
     if (HasAuthority())
     {
         TriggerVolume->OnComponentBeginOverlap.AddDynamic(this, &AS_CheckpointTrigger::OnTriggerOverlap);
+
+        // Register with the manager instead of having it scan the world for us.
+        // The StrafeGameMode spawns the manager before BeginPlay is dispatched, so it is normally available here.
+        const AS_StrafeGameState* StrafeGS = GetWorld() ? GetWorld()->GetGameState<AS_StrafeGameState>() : nullptr;
+        if (StrafeGS && StrafeGS->StrafeManager)
+        {
+            StrafeGS->StrafeManager->RegisterCheckpoint(this);
+        }
     }
 }
 
+void AS_CheckpointTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Only unregister when this checkpoint leaves a running world; on level teardown the manager goes away too.
+    if (HasAuthority() && (EndPlayReason == EEndPlayReason::Destroyed || EndPlayReason == EEndPlayReason::RemovedFromWorld))
+    {
+        const AS_StrafeGameState* StrafeGS = GetWorld() ? GetWorld()->GetGameState<AS_StrafeGameState>() : nullptr;
+        if (StrafeGS && StrafeGS->StrafeManager)
+        {
+            StrafeGS->StrafeManager->UnregisterCheckpoint(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AS_CheckpointTrigger::OnTriggerOverlap(
     UPrimitiveComponent* OverlappedComponent,
     AActor* OtherActor,
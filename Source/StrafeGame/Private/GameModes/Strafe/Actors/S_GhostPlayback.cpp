@@ -0,0 +1,79 @@
+#include "GameModes/Strafe/Actors/S_GhostPlayback.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SceneComponent.h"
+
+AS_GhostPlayback::AS_GhostPlayback()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
+
+    // Purely local: the ghost must never cost bandwidth or server time.
+    bReplicates = false;
+    SetReplicateMovement(false);
+    SetActorEnableCollision(false);
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+    GhostMesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("GhostMesh"));
+    GhostMesh->SetupAttachment(RootComponent);
+    GhostMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    GhostMesh->SetGenerateOverlapEvents(false);
+    GhostMesh->SetCanEverAffectNavigation(false);
+    GhostMesh->CastShadow = false;
+    GhostMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+
+    bHoldAtFinish = false;
+    PlaybackTime = 0.0f;
+    SetActorHiddenInGame(true);
+}
+
+void AS_GhostPlayback::SetGhostTrack(FS_GhostTrack&& InTrack)
+{
+    GhostTrack = MoveTemp(InTrack);
+    StopPlayback();
+}
+
+void AS_GhostPlayback::StartPlayback()
+{
+    if (GhostTrack.IsEmpty())
+    {
+        return;
+    }
+
+    PlaybackTime = 0.0f;
+    ApplySample(GhostTrack.Evaluate(0.0f));
+    SetActorHiddenInGame(false);
+    SetActorTickEnabled(true);
+}
+
+void AS_GhostPlayback::StopPlayback()
+{
+    SetActorTickEnabled(false);
+    SetActorHiddenInGame(true);
+}
+
+void AS_GhostPlayback::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    PlaybackTime += DeltaSeconds;
+    ApplySample(GhostTrack.Evaluate(PlaybackTime));
+
+    if (PlaybackTime >= GhostTrack.GetDuration())
+    {
+        if (bHoldAtFinish)
+        {
+            SetActorTickEnabled(false);
+        }
+        else
+        {
+            StopPlayback();
+        }
+    }
+}
+
+void AS_GhostPlayback::ApplySample(const FS_GhostSample& Sample)
+{
+    CurrentSample = Sample;
+    SetActorLocationAndRotation(Sample.Location, FRotator(0.0f, Sample.Yaw, 0.0f), false, nullptr, ETeleportType::TeleportPhysics);
+}
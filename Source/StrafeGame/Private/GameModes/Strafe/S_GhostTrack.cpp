@@ -0,0 +1,218 @@
+#include "GameModes/Strafe/S_GhostTrack.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace GhostTrackFormat
+{
+    /** "SGH1" */
+    constexpr uint32 Magic = 0x53474831;
+
+    /** An hour at 60 Hz. Longer tracks are rejected as malformed. */
+    constexpr int32 MaxSamples = 60 * 60 * 60;
+
+    /** Seven varints per sample, at least one byte each. */
+    constexpr int32 MinBytesPerSample = 7;
+
+    /** Refuse to decompress anything larger than MaxSamples worth of worst-case (5 byte) varints. */
+    constexpr int32 MaxEncodedSize = MaxSamples * MinBytesPerSample * 5;
+
+    inline uint16 QuantizeYaw(float Yaw)
+    {
+        return static_cast<uint16>(FRotator::CompressAxisToShort(Yaw));
+    }
+
+    inline float DequantizeYaw(uint16 Yaw)
+    {
+        return FRotator::DecompressAxisFromShort(Yaw);
+    }
+
+    /** Signed 16-bit difference between two quantized yaws, taking the short way around. */
+    inline int32 YawDelta(uint16 From, uint16 To)
+    {
+        return static_cast<int16>(static_cast<uint16>(To - From));
+    }
+}
+
+void FS_GhostTrack::Reset(int32 InSampleRateHz)
+{
+    SampleRateHz = FMath::Clamp(InSampleRateHz, 1, 120);
+    NumSamples = 0;
+    Encoded.Reset();
+    Decoded.Reset();
+    EncoderState = FQuantizedState();
+}
+
+void FS_GhostTrack::AddSample(const FVector& Location, const FVector& Velocity, float Yaw)
+{
+    FQuantizedState NewState;
+    NewState.Location = FIntVector(FMath::RoundToInt(Location.X), FMath::RoundToInt(Location.Y), FMath::RoundToInt(Location.Z));
+    NewState.Velocity = FIntVector(FMath::RoundToInt(Velocity.X), FMath::RoundToInt(Velocity.Y), FMath::RoundToInt(Velocity.Z));
+    NewState.Yaw = GhostTrackFormat::QuantizeYaw(Yaw);
+
+    // The first sample is relative to the origin; later ones to the linear extrapolation.
+    const FIntVector Predicted = NumSamples > 0 ? ExtrapolateLocation(EncoderState, SampleRateHz) : FIntVector::ZeroValue;
+    const FIntVector LocationResidual = NewState.Location - Predicted;
+    const FIntVector VelocityDelta = NewState.Velocity - EncoderState.Velocity;
+
+    WriteVarInt(Encoded, LocationResidual.X);
+    WriteVarInt(Encoded, LocationResidual.Y);
+    WriteVarInt(Encoded, LocationResidual.Z);
+    WriteVarInt(Encoded, VelocityDelta.X);
+    WriteVarInt(Encoded, VelocityDelta.Y);
+    WriteVarInt(Encoded, VelocityDelta.Z);
+    WriteVarInt(Encoded, GhostTrackFormat::YawDelta(EncoderState.Yaw, NewState.Yaw));
+
+    EncoderState = NewState;
+    ++NumSamples;
+}
+
+bool FS_GhostTrack::Serialize(TArray<uint8>& OutBytes) const
+{
+    OutBytes.Reset();
+
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Encoded.Num());
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Encoded.GetData(), Encoded.Num()))
+    {
+        return false;
+    }
+    Compressed.SetNum(CompressedSize);
+
+    FMemoryWriter Writer(OutBytes);
+    uint32 Magic = GhostTrackFormat::Magic;
+    int32 SampleRate = SampleRateHz;
+    int32 SampleCount = NumSamples;
+    int32 EncodedSize = Encoded.Num();
+    Writer << Magic << SampleRate << SampleCount << EncodedSize << Compressed;
+    return !Writer.IsError();
+}
+
+bool FS_GhostTrack::Deserialize(const TArray<uint8>& InBytes)
+{
+    FMemoryReader Reader(InBytes);
+    uint32 Magic = 0;
+    int32 SampleRate = 0;
+    int32 SampleCount = 0;
+    int32 EncodedSize = 0;
+    TArray<uint8> Compressed;
+    Reader << Magic << SampleRate << SampleCount << EncodedSize;
+    if (Reader.IsError() || Magic != GhostTrackFormat::Magic || EncodedSize < 0 || EncodedSize > GhostTrackFormat::MaxEncodedSize)
+    {
+        return false;
+    }
+    // Validate the count before anything is sized from it; every sample takes at least MinBytesPerSample encoded bytes.
+    if (SampleCount < 0 || SampleCount > GhostTrackFormat::MaxSamples || SampleCount > EncodedSize / GhostTrackFormat::MinBytesPerSample)
+    {
+        return false;
+    }
+    Reader << Compressed;
+    if (Reader.IsError())
+    {
+        return false;
+    }
+
+    Reset(SampleRate);
+    Encoded.SetNumUninitialized(EncodedSize);
+    if (EncodedSize > 0 && !FCompression::UncompressMemory(NAME_Zlib, Encoded.GetData(), EncodedSize, Compressed.GetData(), Compressed.Num()))
+    {
+        Reset(SampleRate);
+        return false;
+    }
+
+    // Decode with exactly the same prediction the encoder used.
+    Decoded.Reserve(SampleCount);
+    FQuantizedState State;
+    int32 Offset = 0;
+    for (int32 SampleIndex = 0; SampleIndex < SampleCount; ++SampleIndex)
+    {
+        int32 Values[7];
+        for (int32& Value : Values)
+        {
+            if (!ReadVarInt(Encoded, Offset, Value))
+            {
+                Reset(SampleRate);
+                return false;
+            }
+        }
+
+        const FIntVector Predicted = SampleIndex > 0 ? ExtrapolateLocation(State, SampleRateHz) : FIntVector::ZeroValue;
+        State.Location = Predicted + FIntVector(Values[0], Values[1], Values[2]);
+        State.Velocity = State.Velocity + FIntVector(Values[3], Values[4], Values[5]);
+        State.Yaw = static_cast<uint16>(State.Yaw + Values[6]);
+
+        FS_GhostSample& Sample = Decoded.AddDefaulted_GetRef();
+        Sample.Location = FVector(State.Location);
+        Sample.Velocity = FVector(State.Velocity);
+        Sample.Yaw = GhostTrackFormat::DequantizeYaw(State.Yaw);
+    }
+
+    EncoderState = State;
+    NumSamples = SampleCount;
+    return true;
+}
+
+FS_GhostSample FS_GhostTrack::Evaluate(float Time) const
+{
+    if (Decoded.Num() == 0)
+    {
+        return FS_GhostSample();
+    }
+
+    const float SampleInterval = 1.0f / SampleRateHz;
+    const float SamplePosition = FMath::Max(0.0f, Time) * SampleRateHz;
+    const int32 Index = FMath::Min(FMath::FloorToInt(SamplePosition), Decoded.Num() - 1);
+    if (Index >= Decoded.Num() - 1)
+    {
+        return Decoded.Last();
+    }
+
+    const FS_GhostSample& A = Decoded[Index];
+    const FS_GhostSample& B = Decoded[Index + 1];
+    const float Alpha = SamplePosition - Index;
+
+    FS_GhostSample Result;
+    Result.Location = FMath::CubicInterp(A.Location, A.Velocity * SampleInterval, B.Location, B.Velocity * SampleInterval, Alpha);
+    Result.Velocity = FMath::Lerp(A.Velocity, B.Velocity, Alpha);
+    Result.Yaw = A.Yaw + FRotator::NormalizeAxis(B.Yaw - A.Yaw) * Alpha;
+    return Result;
+}
+
+FIntVector FS_GhostTrack::ExtrapolateLocation(const FQuantizedState& State, int32 InSampleRateHz)
+{
+    // Integer division keeps encoder and decoder bit-identical on every platform.
+    return State.Location + State.Velocity / InSampleRateHz;
+}
+
+void FS_GhostTrack::WriteVarInt(TArray<uint8>& Stream, int32 Value)
+{
+    // Zigzag so small negative values stay small, then 7 bits per byte.
+    uint32 ZigZag = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+    while (ZigZag >= 0x80)
+    {
+        Stream.Add(static_cast<uint8>(ZigZag | 0x80));
+        ZigZag >>= 7;
+    }
+    Stream.Add(static_cast<uint8>(ZigZag));
+}
+
+bool FS_GhostTrack::ReadVarInt(const TArray<uint8>& Stream, int32& Offset, int32& OutValue)
+{
+    uint32 ZigZag = 0;
+    for (int32 Shift = 0; Shift < 35; Shift += 7)
+    {
+        if (!Stream.IsValidIndex(Offset))
+        {
+            return false;
+        }
+        const uint8 Byte = Stream[Offset++];
+        ZigZag |= static_cast<uint32>(Byte & 0x7F) << Shift;
+        if ((Byte & 0x80) == 0)
+        {
+            OutValue = static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1);
+            return true;
+        }
+    }
+    return false;
+}
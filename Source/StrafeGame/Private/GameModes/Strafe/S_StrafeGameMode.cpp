@@ -21,11 +21,13 @@ AS_StrafeGameMode::AS_StrafeGameMode()
 
 void AS_StrafeGameMode::StartPlay()
 {
-    Super::StartPlay();
-
-    // This is the reliable point to find all actors and set up bindings.
+    // Spawn the manager before BeginPlay is dispatched so checkpoints can register themselves with it.
     UE_LOG(LogTemp, Log, TEXT("AS_StrafeGameMode::StartPlay: Spawning and initializing StrafeManager."));
     SpawnStrafeManager();
+
+    Super::StartPlay();
+
+    // All level actors have begun play at this point; build the lap graph from the registered checkpoints.
     if (CurrentStrafeManager)
     {
         CurrentStrafeManager->RefreshAndInitializeCheckpoints();
@@ -44,7 +46,7 @@ void AS_StrafeGameMode::InitGameState()
     AS_StrafeGameState* StrafeGS = GetStrafeGameState();
     if (StrafeGS)
     {
-        StrafeGS->SetStrafeManager(CurrentStrafeManager);
+        // The manager is spawned in StartPlay, which hands it to the game state.
         StrafeGS->MatchDurationSeconds = MatchDurationSeconds;
     }
 }
@@ -59,6 +61,7 @@ void AS_StrafeGameMode::PostLogin(APlayerController* NewPlayer)
     {
         if (CurrentStrafeManager)
         {
+            CurrentStrafeManager->RestorePersistedBestTime(StrafePS);
             CurrentStrafeManager->UpdatePlayerInScoreboard(StrafePS);
         }
     }
@@ -155,7 +158,7 @@ void AS_StrafeGameMode::StartMainMatchTimer()
 {
     if (MatchDurationSeconds > 0)
     {
-        GetWorldTimerManager().SetTimer(MatchTimerHandle, this, &AS_StrafeGameMode::UpdateMainMatchTime, 1.0f, true);
+        GetWorldTimerManager().SetTimer(MatchTimerHandle, this, &AS_StrafeGameMode::OnMatchTimerEnd, MatchDurationSeconds, false);
         UE_LOG(LogTemp, Log, TEXT("AS_StrafeGameMode: Main match timer started for %d seconds."), MatchDurationSeconds);
     }
     else
@@ -164,25 +167,13 @@ void AS_StrafeGameMode::StartMainMatchTimer()
     }
 }
 
-void AS_StrafeGameMode::UpdateMainMatchTime()
+void AS_StrafeGameMode::OnMatchTimerEnd()
 {
-    AS_StrafeGameState* StrafeGS = GetStrafeGameState();
-    if (StrafeGS && IsMatchInProgress())
-    {
-        int32 CurrentTime = StrafeGS->RemainingTime;
-        CurrentTime--;
-        StrafeGS->SetRemainingTime(CurrentTime);
-
-        if (MatchDurationSeconds > 0 && CurrentTime <= 0)
-        {
-            UE_LOG(LogTemp, Log, TEXT("AS_StrafeGameMode: Match time limit reached."));
-            GetWorldTimerManager().ClearTimer(MatchTimerHandle);
-            EndMatch();
-        }
-    }
-    else if (IsMatchInProgress())
+    // Clients count down locally from the replicated phase end time; the server only needs to act here.
+    if (IsMatchInProgress())
     {
-        GetWorldTimerManager().ClearTimer(MatchTimerHandle);
+        UE_LOG(LogTemp, Log, TEXT("AS_StrafeGameMode: Match time limit reached."));
+        EndMatch();
     }
 }
 
@@ -238,6 +229,10 @@ void AS_StrafeGameMode::SpawnStrafeManager()
         if (CurrentStrafeManager)
         {
             UE_LOG(LogTemp, Log, TEXT("AS_StrafeGameMode: Spawned StrafeManager: %s"), *CurrentStrafeManager->GetName());
+            if (AS_StrafeGameState* StrafeGS = GetStrafeGameState())
+            {
+                StrafeGS->SetStrafeManager(CurrentStrafeManager);
+            }
         }
         else
         {
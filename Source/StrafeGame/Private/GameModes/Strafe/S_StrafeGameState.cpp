@@ -11,7 +11,7 @@ AS_StrafeGameState::AS_StrafeGameState()
 
 void AS_StrafeGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-    Super::GetLifetimeReplicatedProps(OutLifetimeProps); // Replicates RemainingTime from base
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps); // Replicates the phase end time from base
     DOREPLIFETIME(AS_StrafeGameState, StrafeManager);
     DOREPLIFETIME(AS_StrafeGameState, MatchDurationSeconds);
     DOREPLIFETIME(AS_StrafeGameState, CurrentMatchStateName);
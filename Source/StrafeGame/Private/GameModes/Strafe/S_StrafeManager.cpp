@@ -4,7 +4,13 @@
 #include "Player/S_Character.h"
 #include "GameModes/Strafe/S_StrafePlayerState.h" 
 #include "Net/UnrealNetwork.h"
-#include "Kismet/GameplayStatics.h" 
+#include "Services/S_LeaderboardStore.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "Misc/FileHelper.h"
+#include "TimerManager.h"
+#include "Engine/GameInstance.h"
+#include "EngineUtils.h"
 #include "Engine/World.h"           
 
 // (Constructor and GetLifetimeReplicatedProps are unchanged)
@@ -17,6 +23,12 @@ AS_StrafeManager::AS_StrafeManager()
     StartLine = nullptr;
     FinishLine = nullptr;
     TotalCheckpointsForFullLap = 0;
+    TotalCheckpointsForRace = 0;
+    LapsToComplete = 1;
+    ActiveLapCount = 1;
+    bCheckpointGraphBuilt = false;
+    CheckpointLayoutHash = 0;
+    GhostSampleRateHz = 10;
 }
 
 void AS_StrafeManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -24,6 +36,10 @@ void AS_StrafeManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(AS_StrafeManager, AllCheckpointsInOrder);
     DOREPLIFETIME(AS_StrafeManager, Scoreboard);
+    DOREPLIFETIME(AS_StrafeManager, LapsToComplete);
+    DOREPLIFETIME(AS_StrafeManager, TotalCheckpointsForFullLap);
+    DOREPLIFETIME(AS_StrafeManager, TotalCheckpointsForRace);
+    DOREPLIFETIME(AS_StrafeManager, ActiveLapCount);
 }
 
 
@@ -37,52 +53,105 @@ void AS_StrafeManager::RefreshAndInitializeCheckpoints()
 {
     if (!HasAuthority()) return;
 
-    for (AS_CheckpointTrigger* CP : AllCheckpointsInOrder)
+    // Drop anything destroyed since it registered.
+    AllCheckpointsInOrder.RemoveAll([](const TObjectPtr<AS_CheckpointTrigger>& CP) { return !IsValid(CP); });
+
+    if (AllCheckpointsInOrder.Num() == 0)
     {
-        if (CP)
+        // Checkpoints register themselves in BeginPlay. If none did, the manager was most likely spawned
+        // after BeginPlay was dispatched, so fall back to a one-off scan.
+        UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: No checkpoints registered themselves. Falling back to a level scan."));
+        for (TActorIterator<AS_CheckpointTrigger> It(GetWorld()); It; ++It)
         {
-            CP->OnCheckpointReachedDelegate.RemoveDynamic(this, &AS_StrafeManager::HandleCheckpointReached);
+            AS_CheckpointTrigger* CP = *It;
+            if (CP && !AllCheckpointsInOrder.Contains(CP))
+            {
+                AllCheckpointsInOrder.Add(CP);
+                CP->OnCheckpointReachedDelegate.AddUniqueDynamic(this, &AS_StrafeManager::HandleCheckpointReached);
+            }
         }
     }
-    AllCheckpointsInOrder.Empty();
-    StartLine = nullptr;
-    FinishLine = nullptr;
-    TotalCheckpointsForFullLap = 0;
 
-    TArray<AActor*> FoundCheckpointActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AS_CheckpointTrigger::StaticClass(), FoundCheckpointActors);
+    UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Building lap graph from %d registered checkpoints."), AllCheckpointsInOrder.Num());
 
-    UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Found %d checkpoint actors in the level."), FoundCheckpointActors.Num());
+    FinalizeCheckpointSetup();
+    bCheckpointGraphBuilt = true;
 
-    for (AActor* Actor : FoundCheckpointActors)
+    // Players who logged in before the graph existed (e.g. a listen server host) get their persisted times now.
+    if (AGameStateBase* GameState = GetWorld()->GetGameState())
     {
-        AS_CheckpointTrigger* CP = Cast<AS_CheckpointTrigger>(Actor);
-        if (CP)
+        for (APlayerState* PlayerState : GameState->PlayerArray)
         {
-            RegisterCheckpoint(CP);
+            RestorePersistedBestTime(Cast<AS_StrafePlayerState>(PlayerState));
         }
     }
-    FinalizeCheckpointSetup();
 }
 
 void AS_StrafeManager::RegisterCheckpoint(AS_CheckpointTrigger* Checkpoint)
 {
-    if (Checkpoint && !AllCheckpointsInOrder.Contains(Checkpoint))
+    if (!HasAuthority() || !Checkpoint || AllCheckpointsInOrder.Contains(Checkpoint))
+    {
+        return;
+    }
+
+    AllCheckpointsInOrder.Add(Checkpoint);
+    Checkpoint->OnCheckpointReachedDelegate.AddUniqueDynamic(this, &AS_StrafeManager::HandleCheckpointReached);
+    UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Registered Checkpoint '%s' (Order: %d, Type: %s) and bound delegate."),
+        *Checkpoint->GetName(),
+        Checkpoint->GetCheckpointOrder(),
+        *UEnum::GetValueAsString(Checkpoint->GetCheckpointType())
+    );
+
+    if (bCheckpointGraphBuilt)
+    {
+        FinalizeCheckpointSetup();
+    }
+}
+
+void AS_StrafeManager::UnregisterCheckpoint(AS_CheckpointTrigger* Checkpoint)
+{
+    if (!HasAuthority() || !Checkpoint)
+    {
+        return;
+    }
+
+    Checkpoint->OnCheckpointReachedDelegate.RemoveDynamic(this, &AS_StrafeManager::HandleCheckpointReached);
+    Checkpoint->SortedIndex = INDEX_NONE;
+    Checkpoint->StageIndex = INDEX_NONE;
+
+    if (AllCheckpointsInOrder.Remove(Checkpoint) > 0 && bCheckpointGraphBuilt && !IsActorBeingDestroyed())
+    {
+        FinalizeCheckpointSetup();
+    }
+}
+
+namespace StrafeCheckpointLayout
+{
+    /** Checkpoint location quantized to 10 uu, so float noise doesn't change the layout. */
+    FIntVector GetPlacement(const AS_CheckpointTrigger& Checkpoint)
     {
-        AllCheckpointsInOrder.Add(Checkpoint);
-        Checkpoint->OnCheckpointReachedDelegate.AddUniqueDynamic(this, &AS_StrafeManager::HandleCheckpointReached);
-        UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Registered Checkpoint '%s' (Order: %d, Type: %s) and bound delegate."),
-            *Checkpoint->GetName(),
-            Checkpoint->GetCheckpointOrder(),
-            *UEnum::GetValueAsString(Checkpoint->GetCheckpointType())
-        );
+        return FIntVector(Checkpoint.GetActorLocation() / 10.0);
     }
 }
 
 void AS_StrafeManager::SortCheckpoints()
 {
+    // Branches share a CheckpointOrder and register in BeginPlay order, which varies between runs. Break ties on
+    // type and placement so the sorted order, and with it the layout hash, only depends on the layout.
     AllCheckpointsInOrder.Sort([](const AS_CheckpointTrigger& A, const AS_CheckpointTrigger& B) {
-        return A.GetCheckpointOrder() < B.GetCheckpointOrder();
+        if (A.GetCheckpointOrder() != B.GetCheckpointOrder())
+        {
+            return A.GetCheckpointOrder() < B.GetCheckpointOrder();
+        }
+        if (A.GetCheckpointType() != B.GetCheckpointType())
+        {
+            return A.GetCheckpointType() < B.GetCheckpointType();
+        }
+        const FIntVector PlacementA = StrafeCheckpointLayout::GetPlacement(A);
+        const FIntVector PlacementB = StrafeCheckpointLayout::GetPlacement(B);
+        if (PlacementA.X != PlacementB.X) return PlacementA.X < PlacementB.X;
+        if (PlacementA.Y != PlacementB.Y) return PlacementA.Y < PlacementB.Y;
+        return PlacementA.Z < PlacementB.Z;
         });
 }
 
@@ -92,8 +161,29 @@ void AS_StrafeManager::FinalizeCheckpointSetup()
 
     SortCheckpoints();
 
+    StartLine = nullptr;
+    FinishLine = nullptr;
+    TotalCheckpointsForFullLap = 0;
+    TotalCheckpointsForRace = 0;
+    TransitionTable.Reset();
+
     if (AllCheckpointsInOrder.Num() > 0)
     {
+        // Cache sorted index and stage on every checkpoint. Checkpoints sharing an order form one stage (branches).
+        int32 NumStages = 0;
+        int32 PreviousOrder = 0;
+        for (int32 Index = 0; Index < AllCheckpointsInOrder.Num(); ++Index)
+        {
+            AS_CheckpointTrigger* CP = AllCheckpointsInOrder[Index];
+            if (Index == 0 || CP->GetCheckpointOrder() != PreviousOrder)
+            {
+                ++NumStages;
+                PreviousOrder = CP->GetCheckpointOrder();
+            }
+            CP->SortedIndex = Index;
+            CP->StageIndex = NumStages - 1;
+        }
+
         bool bFoundStart = false;
         bool bFoundFinish = false;
 
@@ -145,8 +235,40 @@ void AS_StrafeManager::FinalizeCheckpointSetup()
             UE_LOG(LogTemp, Error, TEXT("AS_StrafeManager: Start and Finish line cannot be the same checkpoint actor if there are multiple checkpoints."));
             FinishLine = nullptr;
         }
-        TotalCheckpointsForFullLap = AllCheckpointsInOrder.Num();
-        UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Checkpoint setup finalized. Total Checkpoints (incl. Start/Finish if separate): %d"), TotalCheckpointsForFullLap);
+
+        if (StartLine && StartLine->GetStageIndex() != 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("AS_StrafeManager: Start Line '%s' must have the lowest CheckpointOrder."), *StartLine->GetName());
+        }
+        if (FinishLine && FinishLine->GetStageIndex() != NumStages - 1)
+        {
+            UE_LOG(LogTemp, Error, TEXT("AS_StrafeManager: Finish Line '%s' must have the highest CheckpointOrder."), *FinishLine->GetName());
+        }
+
+        // Validate into ActiveLapCount so the designer's LapsToComplete survives a rebuild with a different layout.
+        ActiveLapCount = FMath::Max(1, LapsToComplete);
+        if (ActiveLapCount > 1 && NumStages < 3)
+        {
+            UE_LOG(LogTemp, Error, TEXT("AS_StrafeManager: Multi-lap races need at least one checkpoint between Start and Finish. Falling back to a single lap."));
+            ActiveLapCount = 1;
+        }
+
+        BuildLapGraph(NumStages);
+
+        // Leaderboards are filed per layout, so moving, adding or reordering checkpoints starts a fresh board.
+        CheckpointLayoutHash = GetTypeHash(ActiveLapCount);
+        for (const AS_CheckpointTrigger* CP : AllCheckpointsInOrder)
+        {
+            const FIntVector Placement = StrafeCheckpointLayout::GetPlacement(*CP);
+            CheckpointLayoutHash = HashCombine(CheckpointLayoutHash, GetTypeHash(CP->GetCheckpointOrder()));
+            CheckpointLayoutHash = HashCombine(CheckpointLayoutHash, GetTypeHash(static_cast<uint8>(CP->GetCheckpointType())));
+            CheckpointLayoutHash = HashCombine(CheckpointLayoutHash, GetTypeHash(Placement));
+        }
+
+        TotalCheckpointsForFullLap = NumStages;
+        TotalCheckpointsForRace = 1 + ActiveLapCount * (NumStages - 1);
+        UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Checkpoint setup finalized. Stages per lap (incl. Start/Finish): %d, Checkpoints: %d, Laps: %d, Progress points per race: %d"),
+            TotalCheckpointsForFullLap, AllCheckpointsInOrder.Num(), ActiveLapCount, TotalCheckpointsForRace);
     }
     else
     {
@@ -154,6 +276,72 @@ void AS_StrafeManager::FinalizeCheckpointSetup()
     }
 }
 
+void AS_StrafeManager::BuildLapGraph(int32 NumStages)
+{
+    const int32 NumCheckpoints = AllCheckpointsInOrder.Num();
+    TransitionTable.Init(false, NumCheckpoints * NumCheckpoints);
+
+    // Checkpoints are sorted, so each stage occupies a contiguous range of the sorted list.
+    TArray<int32> StageFirstIndex;
+    StageFirstIndex.Init(INDEX_NONE, NumStages + 1);
+    for (int32 Index = NumCheckpoints - 1; Index >= 0; --Index)
+    {
+        StageFirstIndex[AllCheckpointsInOrder[Index]->GetStageIndex()] = Index;
+    }
+    StageFirstIndex[NumStages] = NumCheckpoints;
+
+    auto LinkToStage = [this, NumCheckpoints, &StageFirstIndex](AS_CheckpointTrigger* From, int32 ToStage)
+    {
+        const int32 RowOffset = From->GetSortedIndex() * NumCheckpoints;
+        if (From->NextCheckpoints.Num() > 0)
+        {
+            for (AS_CheckpointTrigger* Next : From->NextCheckpoints)
+            {
+                if (Next && Next->GetSortedIndex() != INDEX_NONE && Next->GetStageIndex() == ToStage)
+                {
+                    TransitionTable[RowOffset + Next->GetSortedIndex()] = true;
+                }
+                else if (Next)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Ignoring NextCheckpoints entry '%s' on '%s'; it is not registered or not in the next stage."),
+                        *Next->GetName(), *From->GetName());
+                }
+            }
+            return;
+        }
+
+        for (int32 ToIndex = StageFirstIndex[ToStage]; ToIndex < StageFirstIndex[ToStage + 1]; ++ToIndex)
+        {
+            TransitionTable[RowOffset + ToIndex] = true;
+        }
+    };
+
+    for (AS_CheckpointTrigger* CP : AllCheckpointsInOrder)
+    {
+        const int32 Stage = CP->GetStageIndex();
+        if (Stage + 1 < NumStages)
+        {
+            LinkToStage(CP, Stage + 1);
+        }
+    }
+
+    // Multi-lap: the finish line wraps back to the first stage after the start.
+    if (FinishLine && ActiveLapCount > 1 && NumStages >= 3)
+    {
+        LinkToStage(FinishLine, 1);
+    }
+}
+
+bool AS_StrafeManager::IsValidCheckpointTransition(int32 FromIndex, int32 ToIndex) const
+{
+    const int32 NumCheckpoints = AllCheckpointsInOrder.Num();
+    if (FromIndex < 0 || ToIndex < 0 || FromIndex >= NumCheckpoints || ToIndex >= NumCheckpoints)
+    {
+        return false;
+    }
+    return TransitionTable[FromIndex * NumCheckpoints + ToIndex];
+}
+
 
 void AS_StrafeManager::HandleCheckpointReached(AS_CheckpointTrigger* Checkpoint, AS_Character* PlayerCharacter)
 {
@@ -172,64 +360,229 @@ void AS_StrafeManager::HandleCheckpointReached(AS_CheckpointTrigger* Checkpoint,
         return;
     }
 
-    const int32 CheckpointIdxInSortedList = AllCheckpointsInOrder.IndexOfByKey(Checkpoint);
-    if (CheckpointIdxInSortedList == INDEX_NONE)
+    const int32 CheckpointIdxInSortedList = Checkpoint->GetSortedIndex();
+    if (!AllCheckpointsInOrder.IsValidIndex(CheckpointIdxInSortedList) || AllCheckpointsInOrder[CheckpointIdxInSortedList] != Checkpoint)
     {
         UE_LOG(LogTemp, Error, TEXT("AS_StrafeManager::HandleCheckpointReached - Reached checkpoint %s not in AllCheckpointsInOrder list!"), *Checkpoint->GetName());
         return;
     }
 
-    if (Checkpoint->GetCheckpointType() == ECheckpointType::Start)
+    if (Checkpoint == StartLine)
     {
-        if (!StrafePS->IsRaceInProgress())
-        {
-            StrafePS->ServerStartRace();
-            StrafePS->ServerReachedCheckpoint(CheckpointIdxInSortedList, TotalCheckpointsForFullLap);
-        }
-        else if (StrafePS->IsRaceInProgress() && StrafePS->GetLastCheckpointReached() == AllCheckpointsInOrder.IndexOfByKey(FinishLine))
+        if (StrafePS->IsRaceInProgress() && StrafePS->GetLastCheckpointNode() == FinishLine->GetSortedIndex())
         {
-            UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Player %s completed a lap and hit Start Line again. Starting new lap."), *StrafePS->GetPlayerName());
-            StrafePS->ServerStartRace(); // This implicitly resets first
-            StrafePS->ServerReachedCheckpoint(CheckpointIdxInSortedList, TotalCheckpointsForFullLap);
+            // Circuits usually route the lap wrap over the start line. The race is still running, so laps remain:
+            // move the racer onto the start node without crediting progress, the wrap edge into stage 1 is credited next.
+            UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Player %s completed a lap and crossed Start Line. Continuing run."), *StrafePS->GetPlayerName());
+            StrafePS->SetLastCheckpointNode(CheckpointIdxInSortedList);
+            return;
         }
-        else if (StrafePS->IsRaceInProgress())
+        if (StrafePS->IsRaceInProgress())
         {
             UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Player %s hit Start Line mid-race out of sequence. Resetting current run."), *StrafePS->GetPlayerName());
-            StrafePS->ServerStartRace(); // This implicitly resets first
-            StrafePS->ServerReachedCheckpoint(CheckpointIdxInSortedList, TotalCheckpointsForFullLap);
         }
+        StrafePS->ServerStartRace(); // This implicitly resets first
+        CreditCheckpoint(StrafePS, CheckpointIdxInSortedList, false);
+        StartGhostRecording(StrafePS);
+        return;
     }
-    else if (Checkpoint->GetCheckpointType() == ECheckpointType::Finish)
+
+    if (!StrafePS->IsRaceInProgress())
     {
-        if (StrafePS->IsRaceInProgress())
-        {
-            if (CheckpointIdxInSortedList == TotalCheckpointsForFullLap - 1 &&
-                StrafePS->GetLastCheckpointReached() == CheckpointIdxInSortedList - 1)
-            {
-                StrafePS->ServerReachedCheckpoint(CheckpointIdxInSortedList, TotalCheckpointsForFullLap);
-                StrafePS->ServerFinishedRace(CheckpointIdxInSortedList, TotalCheckpointsForFullLap);
-                UpdatePlayerInScoreboard(StrafePS);
-            }
-            else {
-                UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Player %s hit Finish Line out of sequence. LastCP: %d, FinishCP Index: %d, Expected Prev: %d"),
-                    *StrafePS->GetPlayerName(), StrafePS->GetLastCheckpointReached(), CheckpointIdxInSortedList, CheckpointIdxInSortedList - 1);
-            }
-        }
+        return;
     }
-    else
+
+    const int32 LastNode = StrafePS->GetLastCheckpointNode();
+    if (!IsValidCheckpointTransition(LastNode, CheckpointIdxInSortedList))
     {
-        if (StrafePS->IsRaceInProgress())
+        UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Player %s hit Checkpoint %s out of sequence. Last checkpoint: %d, Reached: %d"),
+            *StrafePS->GetPlayerName(), *Checkpoint->GetName(), LastNode, CheckpointIdxInSortedList);
+        return;
+    }
+
+    CreditCheckpoint(StrafePS, CheckpointIdxInSortedList, Checkpoint == FinishLine);
+}
+
+void AS_StrafeManager::CreditCheckpoint(AS_StrafePlayerState* StrafePS, int32 NodeIndex, bool bIsFinishLine)
+{
+    // Every valid transition advances race progress by exactly one, across branches and laps alike.
+    const int32 NextProgress = StrafePS->GetLastCheckpointReached() + 1;
+    const bool bIsFinalProgressPoint = NextProgress == TotalCheckpointsForRace - 1;
+
+    if (bIsFinalProgressPoint && !bIsFinishLine)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Player %s progress %d does not match checkpoint %d (final point: %d)."),
+            *StrafePS->GetPlayerName(), NextProgress, NodeIndex, TotalCheckpointsForRace - 1);
+        return;
+    }
+
+    StrafePS->ServerReachedCheckpoint(NextProgress, TotalCheckpointsForRace);
+    if (StrafePS->GetLastCheckpointReached() != NextProgress)
+    {
+        return;
+    }
+    StrafePS->SetLastCheckpointNode(NodeIndex);
+
+    if (bIsFinalProgressPoint)
+    {
+        StrafePS->ServerFinishedRace(NextProgress, TotalCheckpointsForRace);
+        FinishGhostRecording(StrafePS, SubmitToLeaderboardStore(StrafePS));
+        UpdatePlayerInScoreboard(StrafePS);
+    }
+    else if (bIsFinishLine)
+    {
+        UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Player %s completed a lap (%d/%d)."),
+            *StrafePS->GetPlayerName(), NextProgress / FMath::Max(1, TotalCheckpointsForFullLap - 1), ActiveLapCount);
+    }
+}
+
+uint64 AS_StrafeManager::SubmitToLeaderboardStore(AS_StrafePlayerState* StrafePS) const
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    US_LeaderboardStore* Store = GameInstance ? GameInstance->GetSubsystem<US_LeaderboardStore>() : nullptr;
+    if (!Store || !StrafePS)
+    {
+        return 0;
+    }
+
+    FLeaderboardRecord Record;
+    Record.MapName = GetLeaderboardMapName();
+    Record.LayoutHash = CheckpointLayoutHash;
+    Record.PlayerId = GetLeaderboardPlayerId(StrafePS);
+    Record.PlayerName = StrafePS->GetPlayerName();
+    Record.TimeMs = FMath::RoundToInt(StrafePS->GetCurrentRaceTime() * 1000.0f);
+    for (const float SplitTime : StrafePS->GetCurrentSplitTimes())
+    {
+        Record.SplitTimesMs.Add(FMath::RoundToInt(SplitTime * 1000.0f));
+    }
+
+    const uint64 RecordId = Store->SubmitTime(MoveTemp(Record));
+    if (RecordId != 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Persisted new personal best for %s. Rank %d on this layout."),
+            *StrafePS->GetPlayerName(), Store->GetPlayerRank(GetLeaderboardMapName(), CheckpointLayoutHash, GetLeaderboardPlayerId(StrafePS)));
+    }
+    return RecordId;
+}
+
+void AS_StrafeManager::StartGhostRecording(AS_StrafePlayerState* StrafePS)
+{
+    if (!HasAuthority() || !StrafePS || GhostSampleRateHz <= 0)
+    {
+        return;
+    }
+
+    FS_GhostTrack& Track = GhostRecordings.FindOrAdd(StrafePS);
+    Track.Reset(GhostSampleRateHz);
+    AddGhostSample(StrafePS, Track);
+
+    if (!GetWorldTimerManager().IsTimerActive(GhostSampleTimerHandle))
+    {
+        GetWorldTimerManager().SetTimer(GhostSampleTimerHandle, this, &AS_StrafeManager::SampleGhostRecordings, 1.0f / GhostSampleRateHz, true);
+    }
+}
+
+void AS_StrafeManager::SampleGhostRecordings()
+{
+    for (auto It = GhostRecordings.CreateIterator(); It; ++It)
+    {
+        AS_StrafePlayerState* StrafePS = It.Key().Get();
+        if (!StrafePS || !StrafePS->IsRaceInProgress() || !AddGhostSample(StrafePS, It.Value()))
         {
-            if (StrafePS->GetLastCheckpointReached() == CheckpointIdxInSortedList - 1)
-            {
-                StrafePS->ServerReachedCheckpoint(CheckpointIdxInSortedList, TotalCheckpointsForFullLap);
-            }
-            else {
-                UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Player %s hit Intermediate Checkpoint %s out of sequence. LastCP: %d, CP Index: %d, Expected Prev: %d"),
-                    *StrafePS->GetPlayerName(), *Checkpoint->GetName(), StrafePS->GetLastCheckpointReached(), CheckpointIdxInSortedList, CheckpointIdxInSortedList - 1);
-            }
+            It.RemoveCurrent();
         }
     }
+
+    if (GhostRecordings.Num() == 0)
+    {
+        GetWorldTimerManager().ClearTimer(GhostSampleTimerHandle);
+    }
+}
+
+bool AS_StrafeManager::AddGhostSample(AS_StrafePlayerState* StrafePS, FS_GhostTrack& Track)
+{
+    const APawn* Pawn = StrafePS->GetPawn();
+    if (!Pawn)
+    {
+        return false;
+    }
+
+    Track.AddSample(Pawn->GetActorLocation(), Pawn->GetVelocity(), Pawn->GetActorRotation().Yaw);
+    return true;
+}
+
+void AS_StrafeManager::FinishGhostRecording(AS_StrafePlayerState* StrafePS, uint64 RecordId)
+{
+    FS_GhostTrack Track;
+    if (!GhostRecordings.RemoveAndCopyValue(StrafePS, Track) || RecordId == 0)
+    {
+        return;
+    }
+
+    // Capture the crossing itself so the ghost reaches the finish line.
+    AddGhostSample(StrafePS, Track);
+
+    TArray<uint8> GhostData;
+    if (!Track.Serialize(GhostData))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Failed to encode ghost for %s."), *StrafePS->GetPlayerName());
+        return;
+    }
+
+    const FString GhostPath = US_LeaderboardStore::GetRecordFilePath(RecordId, TEXT("ghost"));
+    if (!FFileHelper::SaveArrayToFile(GhostData, *GhostPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AS_StrafeManager: Failed to save ghost to %s."), *GhostPath);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AS_StrafeManager: Recorded ghost for %s: %d samples, %d bytes."), *StrafePS->GetPlayerName(), Track.GetNumSamples(), GhostData.Num());
+    StrafePS->ClientReceiveGhost(GhostData);
+}
+
+void AS_StrafeManager::SendPersistedGhost(AS_StrafePlayerState* StrafePS, uint64 RecordId) const
+{
+    TArray<uint8> GhostData;
+    if (StrafePS && FFileHelper::LoadFileToArray(GhostData, *US_LeaderboardStore::GetRecordFilePath(RecordId, TEXT("ghost")), FILEREAD_Silent))
+    {
+        StrafePS->ClientReceiveGhost(GhostData);
+    }
+}
+
+void AS_StrafeManager::RestorePersistedBestTime(AS_StrafePlayerState* StrafePS)
+{
+    if (!HasAuthority() || !StrafePS || !bCheckpointGraphBuilt)
+    {
+        return;
+    }
+
+    UGameInstance* GameInstance = GetGameInstance();
+    US_LeaderboardStore* Store = GameInstance ? GameInstance->GetSubsystem<US_LeaderboardStore>() : nullptr;
+    const FLeaderboardRecord* PersonalBest = Store ? Store->FindPersonalBest(GetLeaderboardMapName(), CheckpointLayoutHash, GetLeaderboardPlayerId(StrafePS)) : nullptr;
+    if (!PersonalBest)
+    {
+        return;
+    }
+
+    FPlayerStrafeRaceTime BestTime;
+    BestTime.TotalTime = PersonalBest->TimeMs / 1000.0f;
+    for (const int32 SplitTimeMs : PersonalBest->SplitTimesMs)
+    {
+        BestTime.SplitTimes.Add(SplitTimeMs / 1000.0f);
+    }
+    StrafePS->ServerRestoreBestRaceTime(BestTime);
+    UpdatePlayerInScoreboard(StrafePS);
+    SendPersistedGhost(StrafePS, PersonalBest->RecordId);
+}
+
+FString AS_StrafeManager::GetLeaderboardMapName() const
+{
+    return UWorld::RemovePIEPrefix(GetWorld()->GetMapName());
+}
+
+FString AS_StrafeManager::GetLeaderboardPlayerId(const AS_StrafePlayerState* StrafePS)
+{
+    const FUniqueNetIdRepl& UniqueId = StrafePS->GetUniqueId();
+    return UniqueId.IsValid() ? UniqueId.ToString() : StrafePS->GetPlayerName();
 }
 
 void AS_StrafeManager::UpdatePlayerInScoreboard(AS_PlayerState* PlayerStateBase)
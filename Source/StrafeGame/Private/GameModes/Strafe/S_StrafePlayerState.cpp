@@ -1,4 +1,6 @@
 #include "GameModes/Strafe/S_StrafePlayerState.h"
+#include "GameModes/Strafe/Actors/S_GhostPlayback.h"
+#include "GameModes/Strafe/S_GhostTrack.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
 
@@ -9,8 +11,11 @@ AS_StrafePlayerState::AS_StrafePlayerState()
 
     CurrentRaceTime = 0.0f;
     LastCheckpointReached = -1;
+    LastCheckpointNode = INDEX_NONE;
     bIsRaceActiveForPlayer = false;
+    RaceStartCount = 0;
     BestRaceTime.Reset();
+    GhostPlaybackClass = AS_GhostPlayback::StaticClass();
 }
 
 void AS_StrafePlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -22,6 +27,7 @@ void AS_StrafePlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
     DOREPLIFETIME_CONDITION_NOTIFY(AS_StrafePlayerState, BestRaceTime, COND_None, REPNOTIFY_Always);
     DOREPLIFETIME_CONDITION_NOTIFY(AS_StrafePlayerState, LastCheckpointReached, COND_None, REPNOTIFY_Always);
     DOREPLIFETIME_CONDITION_NOTIFY(AS_StrafePlayerState, bIsRaceActiveForPlayer, COND_None, REPNOTIFY_Always);
+    DOREPLIFETIME(AS_StrafePlayerState, RaceStartCount);
 }
 
 void AS_StrafePlayerState::Tick(float DeltaSeconds)
@@ -35,6 +41,10 @@ void AS_StrafePlayerState::Tick(float DeltaSeconds)
 
 void AS_StrafePlayerState::Reset()
 {
+    if (bPreservingStateForTravel)
+    {
+        return;
+    }
     Super::Reset();
     if (HasAuthority())
     {
@@ -45,11 +55,22 @@ void AS_StrafePlayerState::Reset()
 void AS_StrafePlayerState::CopyProperties(APlayerState* InPlayerState)
 {
     Super::CopyProperties(InPlayerState);
-    AS_StrafePlayerState* SourceStrafePS = Cast<AS_StrafePlayerState>(InPlayerState);
-    if (SourceStrafePS && HasAuthority())
+    // Copy from this (outgoing) PlayerState into the new one.
+    AS_StrafePlayerState* TargetStrafePS = Cast<AS_StrafePlayerState>(InPlayerState);
+    if (TargetStrafePS && HasAuthority())
+    {
+        TargetStrafePS->BestRaceTime = BestRaceTime;
+    }
+}
+
+void AS_StrafePlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (GhostPlayback)
     {
-        this->BestRaceTime = SourceStrafePS->BestRaceTime;
+        GhostPlayback->Destroy();
+        GhostPlayback = nullptr;
     }
+    Super::EndPlay(EndPlayReason);
 }
 
 void AS_StrafePlayerState::ServerStartRace()
@@ -59,8 +80,10 @@ void AS_StrafePlayerState::ServerStartRace()
         UE_LOG(LogTemp, Warning, TEXT("[STRAFE DEBUG] PlayerState '%s': ServerStartRace called."), *GetPlayerName());
         ServerResetRaceState();
         bIsRaceActiveForPlayer = true;
+        ++RaceStartCount;
         SetActorTickEnabled(true); // <-- CRITICAL FIX: Enable tick to count time.
         OnRep_IsRaceActiveForPlayer();
+        OnRep_RaceStartCount();
         BroadcastStrafeStateUpdate();
     }
 }
@@ -125,6 +148,7 @@ void AS_StrafePlayerState::ServerResetRaceState()
         CurrentSplitTimes.Empty();
         CurrentSplitDeltas.Empty();
         LastCheckpointReached = -1;
+        LastCheckpointNode = INDEX_NONE;
         bIsRaceActiveForPlayer = false;
         SetActorTickEnabled(false);
 
@@ -137,6 +161,40 @@ void AS_StrafePlayerState::ServerResetRaceState()
     }
 }
 
+void AS_StrafePlayerState::ServerRestoreBestRaceTime(const FPlayerStrafeRaceTime& InBestRaceTime)
+{
+    if (HasAuthority() && InBestRaceTime.IsValid())
+    {
+        if (!BestRaceTime.IsValid() || InBestRaceTime.TotalTime < BestRaceTime.TotalTime)
+        {
+            BestRaceTime = InBestRaceTime;
+            OnRep_BestRaceTime();
+        }
+    }
+}
+
+void AS_StrafePlayerState::ClientReceiveGhost_Implementation(const TArray<uint8>& GhostData)
+{
+    FS_GhostTrack Track;
+    if (!Track.Deserialize(GhostData))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AS_StrafePlayerState: Received malformed ghost data (%d bytes)."), GhostData.Num());
+        return;
+    }
+
+    if (!GhostPlayback && GhostPlaybackClass && GetWorld())
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        GhostPlayback = GetWorld()->SpawnActor<AS_GhostPlayback>(GhostPlaybackClass, SpawnParams);
+    }
+
+    if (GhostPlayback)
+    {
+        GhostPlayback->SetGhostTrack(MoveTemp(Track));
+    }
+}
+
 void AS_StrafePlayerState::OnRep_CurrentRaceTime() { BroadcastStrafeStateUpdate(); }
 void AS_StrafePlayerState::OnRep_CurrentSplitTimes() { BroadcastStrafeStateUpdate(); }
 void AS_StrafePlayerState::OnRep_CurrentSplitDeltas() { BroadcastStrafeStateUpdate(); }
@@ -151,11 +209,15 @@ void AS_StrafePlayerState::OnRep_LastCheckpointReached()
 }
 void AS_StrafePlayerState::OnRep_IsRaceActiveForPlayer()
 {
-    if (bIsRaceActiveForPlayer)
+    BroadcastStrafeStateUpdate();
+}
+void AS_StrafePlayerState::OnRep_RaceStartCount()
+{
+    if (GhostPlayback)
     {
-        OnStrafePlayerRaceStartedDelegate.Broadcast();
+        GhostPlayback->StartPlayback();
     }
-    BroadcastStrafeStateUpdate();
+    OnStrafePlayerRaceStartedDelegate.Broadcast();
 }
 void AS_StrafePlayerState::BroadcastStrafeStateUpdate()
 {
@@ -19,6 +19,7 @@ AS_PlayerState::AS_PlayerState()
 
     PrimaryActorTick.bCanEverTick = false;
     bIsDead = false;
+    bPreservingStateForTravel = false;
 }
 
 void AS_PlayerState::BeginPlay()
@@ -46,6 +47,11 @@ void AS_PlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 
 void AS_PlayerState::Reset()
 {
+    if (bPreservingStateForTravel)
+    {
+        // About to be copied into the next map's PlayerState and destroyed.
+        return;
+    }
     Super::Reset();
     bIsDead = false;
     // Server should re-initialize attributes and abilities for a clean state
@@ -75,12 +81,62 @@ void AS_PlayerState::ClientInitialize(AController* C)
 
 void AS_PlayerState::CopyProperties(APlayerState* InPlayerState)
 {
+    // Copies from this (outgoing) PlayerState into InPlayerState. Death state is deliberately not carried over.
     Super::CopyProperties(InPlayerState);
-    // AS_PlayerState* SourcePlayerState = Cast<AS_PlayerState>(InPlayerState);
-    // if (SourcePlayerState)
-    // {
-    //      this->bIsDead = SourcePlayerState->bIsDead; // Though death state might not typically be copied
-    // }
+
+    AS_PlayerState* TargetPlayerState = Cast<AS_PlayerState>(InPlayerState);
+    if (TargetPlayerState && HasAuthority())
+    {
+        CopyAbilitySystemState(TargetPlayerState);
+    }
+}
+
+void AS_PlayerState::CopyAbilitySystemState(AS_PlayerState* TargetPlayerState) const
+{
+    UAbilitySystemComponent* TargetASC = TargetPlayerState ? TargetPlayerState->GetAbilitySystemComponent() : nullptr;
+    if (!AbilitySystemComponent || !TargetASC)
+    {
+        return;
+    }
+
+    // Abilities granted during play (the defaults were already granted in the target's BeginPlay).
+    for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+    {
+        if (!Spec.Ability)
+        {
+            continue;
+        }
+        const TSubclassOf<UGameplayAbility> AbilityClass = Spec.Ability->GetClass();
+        if (DefaultPlayerAbilities.Contains(AbilityClass) || TargetASC->FindAbilitySpecFromClass(AbilityClass))
+        {
+            continue;
+        }
+        TargetASC->GiveAbility(FGameplayAbilitySpec(AbilityClass, Spec.Level, Spec.InputID, TargetPlayerState));
+    }
+
+    // Persistent effects such as cosmetics or unlocks. Re-made with a fresh context so nothing references the old world.
+    if (PersistentEffectTags.IsEmpty())
+    {
+        return;
+    }
+    const FGameplayEffectQuery Query = FGameplayEffectQuery::MakeQuery_MatchAnyEffectTags(PersistentEffectTags);
+    for (const FActiveGameplayEffectHandle& Handle : AbilitySystemComponent->GetActiveEffects(Query))
+    {
+        const FActiveGameplayEffect* ActiveEffect = AbilitySystemComponent->GetActiveGameplayEffect(Handle);
+        if (!ActiveEffect || !ActiveEffect->Spec.Def || ActiveEffect->Spec.GetDuration() != FGameplayEffectConstants::INFINITE_DURATION)
+        {
+            continue;
+        }
+
+        FGameplayEffectContextHandle EffectContext = TargetASC->MakeEffectContext();
+        EffectContext.AddSourceObject(TargetPlayerState);
+        FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(ActiveEffect->Spec.Def->GetClass(), ActiveEffect->Spec.GetLevel(), EffectContext);
+        if (SpecHandle.IsValid())
+        {
+            SpecHandle.Data->SetStackCount(ActiveEffect->Spec.GetStackCount());
+            TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+        }
+    }
 }
 
 UAbilitySystemComponent* AS_PlayerState::GetAbilitySystemComponent() const
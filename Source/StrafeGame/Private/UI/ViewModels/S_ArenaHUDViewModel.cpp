@@ -153,19 +153,30 @@ void US_ArenaHUDViewModel::UpdateKillfeed()
 }
 
 
+void US_ArenaHUDViewModel::FlushDirtyFields(uint32 DirtyFields)
+{
+    if (DirtyFields & DirtyScore)
+    {
+        UpdateArenaSpecificData();
+    }
+    if (DirtyFields & DirtyKillfeed)
+    {
+        UpdateKillfeed();
+    }
+    Super::FlushDirtyFields(DirtyFields); // Notify the View (WBP_ArenaStatusWidget)
+}
+
 void US_ArenaHUDViewModel::HandleLocalPlayerScoreUpdated(AS_ArenaPlayerState* InPlayerState, int32 NewFrags, int32 NewDeaths)
 {
     if (InPlayerState == LocalArenaPlayerState.Get())
     {
         PlayerFrags = NewFrags;
         PlayerDeaths = NewDeaths;
-        UpdateArenaSpecificData();
-        OnGameModeViewModelUpdated.Broadcast();
+        MarkFieldsDirty(DirtyScore);
     }
 }
 
 void US_ArenaHUDViewModel::HandleGameStateKillfeedUpdated()
 {
-    UpdateKillfeed();
-    OnGameModeViewModelUpdated.Broadcast(); // Notify the View (WBP_ArenaStatusWidget)
+    MarkFieldsDirty(DirtyKillfeed);
 }
\ No newline at end of file
@@ -40,7 +40,7 @@ void US_ChargedShotgunViewModel::HandlePrimaryChargeProgressChanged(float NewPro
     if (PrimaryChargeProgress != NewProgress)
     {
         PrimaryChargeProgress = NewProgress;
-        OnWeaponViewModelUpdated.Broadcast();
+        MarkFieldsDirty(DirtyWeaponState);
     }
 }
 
@@ -49,6 +49,6 @@ void US_ChargedShotgunViewModel::HandleSecondaryChargeProgressChanged(float NewP
     if (SecondaryChargeProgress != NewProgress)
     {
         SecondaryChargeProgress = NewProgress;
-        OnWeaponViewModelUpdated.Broadcast();
+        MarkFieldsDirty(DirtyWeaponState);
     }
 }
\ No newline at end of file
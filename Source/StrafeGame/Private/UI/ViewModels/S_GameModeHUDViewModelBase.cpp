@@ -70,14 +70,19 @@ void US_GameModeHUDViewModelBase::UpdateRemainingTime()
     }
 }
 
+void US_GameModeHUDViewModelBase::FlushDirtyFields(uint32 DirtyFields)
+{
+    OnGameModeViewModelUpdated.Broadcast();
+}
+
 void US_GameModeHUDViewModelBase::HandleMatchStateChanged(FName NewMatchState)
 {
     CurrentMatchStateName = NewMatchState;
-    OnGameModeViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyMatchState);
 }
 
 void US_GameModeHUDViewModelBase::HandleRemainingTimeChanged(int32 NewTime)
 {
     RemainingMatchTimeSeconds = NewTime;
-    OnGameModeViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyRemainingTime);
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+// Source/StrafeGame/Private/UI/ViewModels/S_HUDUpdateScheduler.cpp
+#include "UI/ViewModels/S_HUDUpdateScheduler.h"
+#include "UI/ViewModels/S_ViewModelBase.h"
+#include "Framework/Application/SlateApplication.h"
+#include "CoreGlobals.h" // GFrameCounter
+
+FS_HUDUpdateScheduler& FS_HUDUpdateScheduler::Get()
+{
+    static FS_HUDUpdateScheduler Scheduler;
+    return Scheduler;
+}
+
+void FS_HUDUpdateScheduler::Schedule(US_ViewModelBase* ViewModel)
+{
+    if (!ViewModel)
+    {
+        return;
+    }
+
+    if (!FSlateApplication::IsInitialized())
+    {
+        // No UI to batch for (dedicated server, commandlets).
+        ViewModel->FlushPendingFields();
+        return;
+    }
+
+    if (!PreTickHandle.IsValid())
+    {
+        PreTickHandle = FSlateApplication::Get().OnPreTick().AddRaw(this, &FS_HUDUpdateScheduler::Flush);
+    }
+
+    PendingViewModels.Add(ViewModel);
+}
+
+void FS_HUDUpdateScheduler::Flush(float DeltaTime)
+{
+    if (PendingViewModels.Num() == 0)
+    {
+        return;
+    }
+
+    // Indexed loop: flushes may append to PendingViewModels.
+    for (int32 Index = 0; Index < PendingViewModels.Num(); ++Index)
+    {
+        US_ViewModelBase* ViewModel = PendingViewModels[Index].Get();
+        if (!ViewModel || ViewModel->PendingDirtyFields == 0)
+        {
+            continue;
+        }
+
+        if (ViewModel->LastFlushFrame == GFrameCounter)
+        {
+            DeferredViewModels.Add(ViewModel);
+            continue;
+        }
+
+        ViewModel->LastFlushFrame = GFrameCounter;
+        ViewModel->FlushPendingFields();
+    }
+
+    // Swap rather than reallocate; both arrays keep their capacity from frame to frame.
+    PendingViewModels.Reset();
+    Swap(PendingViewModels, DeferredViewModels);
+}
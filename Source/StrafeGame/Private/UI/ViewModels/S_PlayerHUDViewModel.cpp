@@ -58,13 +58,13 @@ void US_PlayerHUDViewModel::Deinitialize()
         WeaponInventoryComponent->OnWeaponAddedDelegate.RemoveDynamic(this, &US_PlayerHUDViewModel::HandleWeaponAdded);
     }
 
-    // Deinitialize and clear ViewModels
-    for (US_WeaponViewModel* VM : WeaponInventoryViewModels)
+    // Deinitialize weapon ViewModels into the pool; a later Initialize reuses them.
+    for (const TPair<TWeakObjectPtr<AS_Weapon>, TObjectPtr<US_WeaponViewModel>>& Pair : WeaponViewModelsByWeapon)
     {
-        if (VM) VM->Deinitialize();
+        ReleaseWeaponViewModel(Pair.Value);
     }
+    WeaponViewModelsByWeapon.Empty();
     WeaponInventoryViewModels.Empty();
-    if (EquippedWeaponViewModel) EquippedWeaponViewModel->Deinitialize();
     EquippedWeaponViewModel = nullptr;
 
     Super::Deinitialize();
@@ -114,19 +114,37 @@ void US_PlayerHUDViewModel::UpdateMaxArmor()
 
 void US_PlayerHUDViewModel::UpdateWeaponInventory()
 {
-    // Deinitialize old ViewModels first
-    for (US_WeaponViewModel* VM : WeaponInventoryViewModels)
+    // Reconcile instead of rebuilding: weapons still held keep their ViewModel (and its attribute bindings),
+    // only added weapons get one from the pool and only removed weapons give theirs back.
+    const TArray<AS_Weapon*>* InventoryList = (WeaponInventoryComponent.IsValid() && GetOwningPlayerController())
+        ? &WeaponInventoryComponent->GetWeaponInventoryList() : nullptr;
+
+    auto IsDisplayed = [InventoryList](const AS_Weapon* Weapon)
+    {
+        return Weapon && Weapon->GetWeaponData() && InventoryList && InventoryList->Contains(Weapon);
+    };
+
+    for (auto It = WeaponViewModelsByWeapon.CreateIterator(); It; ++It)
+    {
+        if (!IsDisplayed(It->Key.Get()))
+        {
+            ReleaseWeaponViewModel(It->Value);
+            It.RemoveCurrent();
+        }
+    }
+
+    WeaponInventoryViewModels.Reset();
+    if (!InventoryList)
     {
-        if (VM) VM->Deinitialize();
+        return;
     }
-    WeaponInventoryViewModels.Empty();
 
-    if (WeaponInventoryComponent.IsValid() && GetOwningPlayerController())
+    for (AS_Weapon* Weapon : *InventoryList)
     {
-        const TArray<AS_Weapon*>& InventoryList = WeaponInventoryComponent->GetWeaponInventoryList();
-        for (AS_Weapon* Weapon : InventoryList)
+        if (Weapon && Weapon->GetWeaponData())
         {
-            if (Weapon && Weapon->GetWeaponData())
+            TObjectPtr<US_WeaponViewModel>& WeaponVM = WeaponViewModelsByWeapon.FindOrAdd(Weapon);
+            if (!WeaponVM)
             {
                 TSubclassOf<US_WeaponViewModel> ViewModelClass = Weapon->GetWeaponData()->WeaponViewModelClass;
                 if (!ViewModelClass) // Fallback to base if not specified
@@ -134,14 +152,45 @@ void US_PlayerHUDViewModel::UpdateWeaponInventory()
                     ViewModelClass = US_WeaponViewModel::StaticClass();
                 }
 
-                US_WeaponViewModel* WeaponVM = NewObject<US_WeaponViewModel>(this, ViewModelClass);
+                WeaponVM = AcquireWeaponViewModel(ViewModelClass);
                 WeaponVM->Initialize(GetOwningPlayerController(), Weapon);
-                WeaponInventoryViewModels.Add(WeaponVM);
             }
+            WeaponInventoryViewModels.Add(WeaponVM);
         }
     }
 }
 
+US_WeaponViewModel* US_PlayerHUDViewModel::AcquireWeaponViewModel(TSubclassOf<US_WeaponViewModel> ViewModelClass)
+{
+    const int32 PooledIndex = PooledWeaponViewModels.IndexOfByPredicate([ViewModelClass](const US_WeaponViewModel* VM)
+    {
+        return VM && VM->GetClass() == ViewModelClass;
+    });
+
+    if (PooledIndex != INDEX_NONE)
+    {
+        US_WeaponViewModel* WeaponVM = PooledWeaponViewModels[PooledIndex];
+        PooledWeaponViewModels.RemoveAtSwap(PooledIndex, EAllowShrinking::No);
+        return WeaponVM;
+    }
+
+    return NewObject<US_WeaponViewModel>(this, ViewModelClass);
+}
+
+void US_PlayerHUDViewModel::ReleaseWeaponViewModel(US_WeaponViewModel* WeaponVM)
+{
+    if (!WeaponVM)
+    {
+        return;
+    }
+
+    WeaponVM->Deinitialize();
+
+    // Views still bound belong to the weapon this ViewModel showed; views of the next weapon bind again.
+    WeaponVM->OnWeaponViewModelUpdated.Clear();
+    PooledWeaponViewModels.Add(WeaponVM);
+}
+
 void US_PlayerHUDViewModel::UpdateEquippedWeapon()
 {
     EquippedWeaponViewModel = nullptr; // Reset first
@@ -170,42 +219,50 @@ void US_PlayerHUDViewModel::UpdateEquippedWeapon()
 }
 
 
+void US_PlayerHUDViewModel::FlushDirtyFields(uint32 DirtyFields)
+{
+    if (DirtyFields & DirtyHealth)
+    {
+        HealthPercentage = (MaxHealth > 0) ? (CurrentHealth / MaxHealth) : 0.0f;
+    }
+    if (DirtyFields & DirtyWeapons)
+    {
+        UpdateWeaponInventory(); // Ensures all VMs are up-to-date or created
+        UpdateEquippedWeapon();  // Sets the correct equipped VM and updates bIsEquipped flags
+    }
+    OnViewModelUpdated.Broadcast();
+}
+
 void US_PlayerHUDViewModel::HandleHealthChanged(const FOnAttributeChangeData& Data)
 {
     CurrentHealth = Data.NewValue;
-    HealthPercentage = (MaxHealth > 0) ? (CurrentHealth / MaxHealth) : 0.0f;
-    OnViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyHealth);
 }
 
 void US_PlayerHUDViewModel::HandleMaxHealthChanged(const FOnAttributeChangeData& Data)
 {
     MaxHealth = Data.NewValue;
-    HealthPercentage = (MaxHealth > 0) ? (CurrentHealth / MaxHealth) : 0.0f;
-    OnViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyHealth);
 }
 
 void US_PlayerHUDViewModel::HandleArmorChanged(const FOnAttributeChangeData& Data)
 {
-    OnViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyArmor);
 }
 
 void US_PlayerHUDViewModel::HandleMaxArmorChanged(const FOnAttributeChangeData& Data)
 {
-    OnViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyArmor);
 }
 
 void US_PlayerHUDViewModel::HandleWeaponEquipped(AS_Weapon* NewWeapon, AS_Weapon* OldWeapon)
 {
-    // It's important that UpdateWeaponInventory is robust enough if a new weapon (not previously in list) is equipped.
-    // The current UpdateWeaponInventory rebuilds the list, which is fine.
-    UpdateWeaponInventory(); // Ensures all VMs are up-to-date or created
-    UpdateEquippedWeapon();  // Sets the correct equipped VM and updates bIsEquipped flags
-    OnViewModelUpdated.Broadcast();
+    // A newly equipped weapon may not be in the list yet, so equipping reconciles the inventory too.
+    MarkFieldsDirty(DirtyWeapons);
 }
 
 void US_PlayerHUDViewModel::HandleWeaponAdded(TSubclassOf<AS_Weapon> WeaponClass)
 {
-    UpdateWeaponInventory();
-    UpdateEquippedWeapon(); // Also update equipped status in case the added weapon was auto-equipped
-    OnViewModelUpdated.Broadcast();
-}
\ No newline at end of file
+    // Also updates equipped status in case the added weapon was auto-equipped.
+    MarkFieldsDirty(DirtyWeapons);
+}
@@ -35,6 +35,6 @@ void US_StickyGrenadeLauncherViewModel::HandleActiveStickyCountChanged(int32 New
     if (ActiveStickyGrenadeCount != NewCount)
     {
         ActiveStickyGrenadeCount = NewCount;
-        OnWeaponViewModelUpdated.Broadcast();
+        MarkFieldsDirty(DirtyWeaponState);
     }
 }
\ No newline at end of file
@@ -63,7 +63,7 @@ void US_StrafeHUDViewModel::UpdateStrafeSpecificData()
 
     if (StrafeGameState.IsValid() && StrafeGameState->StrafeManager)
     {
-        TotalCheckpoints = StrafeGameState->StrafeManager->GetTotalCheckpointsForLap();
+        TotalCheckpoints = StrafeGameState->StrafeManager->GetTotalCheckpointsForRace();
     }
     else
     {
@@ -71,11 +71,19 @@ void US_StrafeHUDViewModel::UpdateStrafeSpecificData()
     }
 }
 
+void US_StrafeHUDViewModel::FlushDirtyFields(uint32 DirtyFields)
+{
+    if (DirtyFields & DirtyRaceState)
+    {
+        UpdateStrafeSpecificData();
+    }
+    Super::FlushDirtyFields(DirtyFields);
+}
+
 void US_StrafeHUDViewModel::HandleStrafeRaceStateChanged(AS_StrafePlayerState* InPlayerState)
 {
     if (InPlayerState == LocalStrafePlayerState.Get())
     {
-        UpdateStrafeSpecificData();
-        OnGameModeViewModelUpdated.Broadcast();
+        MarkFieldsDirty(DirtyRaceState);
     }
 }
\ No newline at end of file
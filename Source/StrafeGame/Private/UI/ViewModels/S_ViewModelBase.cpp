@@ -1,5 +1,6 @@
 #include "UI/ViewModels/S_ViewModelBase.h"
 #include "Player/S_PlayerController.h" // Include for AS_PlayerController
+#include "UI/ViewModels/S_HUDUpdateScheduler.h"
 
 void US_ViewModelBase::Initialize(AS_PlayerController* InOwningPlayerController)
 {
@@ -11,9 +12,32 @@ void US_ViewModelBase::Deinitialize()
 {
     // Base deinitialization logic
     OwningPlayerController.Reset();
+
+    // Changes still pending belong to the Model this ViewModel no longer tracks.
+    PendingDirtyFields = 0;
 }
 
 AS_PlayerController* US_ViewModelBase::GetOwningPlayerController() const
 {
     return OwningPlayerController.Get();
+}
+
+void US_ViewModelBase::MarkFieldsDirty(uint32 Fields)
+{
+    const bool bWasQueued = PendingDirtyFields != 0;
+    PendingDirtyFields |= Fields;
+    if (!bWasQueued && PendingDirtyFields != 0)
+    {
+        FS_HUDUpdateScheduler::Get().Schedule(this);
+    }
+}
+
+void US_ViewModelBase::FlushPendingFields()
+{
+    const uint32 DirtyFields = PendingDirtyFields;
+    PendingDirtyFields = 0;
+    if (DirtyFields != 0)
+    {
+        FlushDirtyFields(DirtyFields);
+    }
 }
\ No newline at end of file
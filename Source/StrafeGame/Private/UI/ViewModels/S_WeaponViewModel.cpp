@@ -46,6 +46,14 @@ void US_WeaponViewModel::Deinitialize()
     WeaponData.Reset();
     PlayerAttributeSet.Reset();
     PlayerAbilitySystemComponent.Reset();
+
+    // Pooled ViewModels are initialized again for another weapon; don't carry this one's state over.
+    CurrentAmmoAttribute = FGameplayAttribute();
+    MaxAmmoAttribute = FGameplayAttribute();
+    CurrentAmmo = 0;
+    MaxAmmo = 0;
+    AmmoPercentage = 0.0f;
+    bIsEquipped = false;
     Super::Deinitialize();
 }
 
@@ -129,15 +137,13 @@ void US_WeaponViewModel::UnbindFromAmmoAttributes()
 void US_WeaponViewModel::HandleCurrentAmmoChanged(const FOnAttributeChangeData& Data)
 {
     CurrentAmmo = Data.NewValue;
-    AmmoPercentage = (MaxAmmo > 0) ? (static_cast<float>(CurrentAmmo) / MaxAmmo) : 0.0f;
-    OnWeaponViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyAmmo);
 }
 
 void US_WeaponViewModel::HandleMaxAmmoChanged(const FOnAttributeChangeData& Data)
 {
     MaxAmmo = Data.NewValue;
-    AmmoPercentage = (MaxAmmo > 0) ? (static_cast<float>(CurrentAmmo) / MaxAmmo) : 0.0f;
-    OnWeaponViewModelUpdated.Broadcast();
+    MarkFieldsDirty(DirtyAmmo);
 }
 
 void US_WeaponViewModel::SetIsEquipped(bool bInIsEquipped)
@@ -145,6 +151,15 @@ void US_WeaponViewModel::SetIsEquipped(bool bInIsEquipped)
     if (bIsEquipped != bInIsEquipped)
     {
         bIsEquipped = bInIsEquipped;
-        OnWeaponViewModelUpdated.Broadcast();
+        MarkFieldsDirty(DirtyEquipped);
+    }
+}
+
+void US_WeaponViewModel::FlushDirtyFields(uint32 DirtyFields)
+{
+    if (DirtyFields & DirtyAmmo)
+    {
+        AmmoPercentage = (MaxAmmo > 0) ? (static_cast<float>(CurrentAmmo) / MaxAmmo) : 0.0f;
     }
-}
\ No newline at end of file
+    OnWeaponViewModelUpdated.Broadcast();
+}
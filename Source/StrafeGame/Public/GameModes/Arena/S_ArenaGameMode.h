@@ -59,7 +59,7 @@ protected:
     virtual void CheckMatchEndConditions();
 
     void StartMainMatchTimer();
-    void UpdateMainMatchTime();
+    void OnMatchTimerEnd();
 
     void StartWarmupTimer();
     void OnWarmupTimerEnd();
@@ -32,8 +32,20 @@ public:
     virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 
     virtual bool PlayerCanRestart(APlayerController* Player);
+
+    /** Marks the outgoing PlayerState so its scores and ASC state survive into the new one. */
+    virtual void HandleSeamlessTravelPlayer(AController*& C) override;
     //~ End AGameModeBase Interface
 
+    /**
+     * Moves the server to the next map in MapRotation, keeping the current game mode.
+     * With bUseSeamlessTravel set, clients stay connected and go through the transition map
+     * (GameMapsSettings.TransitionMap, or an empty world if none is set) instead of reloading.
+     * Restarts the current map if the rotation is empty.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "GameMode|Travel")
+    virtual void TravelToNextMap();
+
 
     /**
      * Called when a player's controlled pawn is killed.
@@ -74,6 +86,13 @@ protected:
     };
     TMap<AController*, FPendingRespawn> PendingRespawns;
 
+    /**
+     * Maps to cycle through after each match, as long package names (e.g. /Game/Maps/Playground).
+     * The next map is picked relative to the current one, so no state has to survive the travel.
+     */
+    UPROPERTY(Config, EditDefaultsOnly, Category = "GameMode|Travel")
+    TArray<FString> MapRotation;
+
     /** Delay before respawning a player after death. */
     UPROPERTY(EditDefaultsOnly, Category = "GameMode|Respawn")
     float RespawnDelay;
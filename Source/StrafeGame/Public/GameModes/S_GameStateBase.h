@@ -29,17 +29,29 @@ public:
     UFUNCTION(BlueprintPure, Category = "GameState")
     FName GetMatchStateName() const { return GetMatchState(); } // GetMatchState() is from AGameStateBase
 
-    /** Time remaining in the current state or match, in seconds. Replicated. */
-    UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_RemainingTime, Category = "GameState|Time")
+    /**
+     * Whole seconds remaining in the current state or match.
+     * Not replicated: every machine derives it locally from PhaseEndServerTime and the synchronized
+     * server world time, and broadcasts OnRemainingTimeChangedDelegate when the displayed second changes.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "GameState|Time")
     int32 RemainingTime;
 
-    UFUNCTION()
-    virtual void OnRep_RemainingTime();
-
-    /** Server function to set the remaining time. */
+    /**
+     * Server function to start a countdown of NewTime seconds for the current phase.
+     * Only the phase end timestamp is replicated, once; a value <= 0 clears the countdown.
+     */
     UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "GameState|Time")
     void SetRemainingTime(int32 NewTime);
 
+    /** Exact time remaining in the current phase, computed from the synchronized server clock. */
+    UFUNCTION(BlueprintPure, Category = "GameState|Time")
+    float GetRemainingTimeSeconds() const;
+
+    /** Server world time at which the current phase ends, or 0 if no countdown is running. */
+    UFUNCTION(BlueprintPure, Category = "GameState|Time")
+    double GetPhaseEndServerTime() const { return PhaseEndServerTime; }
+
     // Delegate for when remaining time changes
     DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRemainingTimeChangedDelegate, int32, NewTimeRemaining);
     UPROPERTY(BlueprintAssignable, Category = "GameState|Events")
@@ -52,4 +64,20 @@ public:
 protected:
     // Override to add any custom replicated properties
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Server world time at which the current phase ends. Replicated once per phase transition. */
+    UPROPERTY(ReplicatedUsing = OnRep_PhaseEndServerTime)
+    double PhaseEndServerTime;
+
+    UFUNCTION()
+    virtual void OnRep_PhaseEndServerTime();
+
+private:
+    /** Local-only timer that wakes up on each whole-second boundary of the countdown. */
+    FTimerHandle CountdownTimerHandle;
+
+    /** Recomputes RemainingTime, broadcasts if it changed and schedules the next second boundary. */
+    void UpdateLocalCountdown();
 };
\ No newline at end of file
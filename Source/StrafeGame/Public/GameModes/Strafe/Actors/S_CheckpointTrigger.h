@@ -34,7 +34,10 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", AdvancedDisplay)
     TObjectPtr<UBillboardComponent> EditorBillboard;
 
-    /** Order of this checkpoint in the race sequence. Start is typically 0. Must be unique among checkpoints. */
+    /**
+     * Order of this checkpoint in the race sequence. Start is typically 0.
+     * Checkpoints sharing the same order are alternative branches of the same stage; a racer must pass exactly one of them.
+     */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Checkpoint Settings", meta = (ExposeOnSpawn = "true"))
     int32 CheckpointOrder;
 
@@ -42,6 +45,13 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Checkpoint Settings", meta = (ExposeOnSpawn = "true"))
     ECheckpointType TypeOfCheckpoint;
 
+    /**
+     * Optional. Restricts which checkpoints of the next stage count as valid next hops from this one (branching routes).
+     * Leave empty to allow every checkpoint of the next stage.
+     */
+    UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Checkpoint Settings")
+    TArray<TObjectPtr<AS_CheckpointTrigger>> NextCheckpoints;
+
     /** Delegate broadcast (on server) when a player character enters the trigger volume. */
     UPROPERTY(BlueprintAssignable, Category = "Checkpoint Events")
     FOnSCheckpointReachedDelegate OnCheckpointReachedDelegate;
@@ -52,11 +62,29 @@ public:
     UFUNCTION(BlueprintPure, Category = "Checkpoint Settings")
     ECheckpointType GetCheckpointType() const { return TypeOfCheckpoint; }
 
+    /** Index of this checkpoint in the StrafeManager's sorted checkpoint list. INDEX_NONE until the manager has built its lap graph. */
+    UFUNCTION(BlueprintPure, Category = "Checkpoint Settings")
+    int32 GetSortedIndex() const { return SortedIndex; }
+
+    /** Stage (distinct CheckpointOrder rank) of this checkpoint. Branches of the same stage share it. */
+    UFUNCTION(BlueprintPure, Category = "Checkpoint Settings")
+    int32 GetStageIndex() const { return StageIndex; }
+
 protected:
     //~ Begin AActor Interface
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     //~ End AActor Interface
 
+    /** Cached by AS_StrafeManager when it builds the lap graph, so overlap handling never has to search for this checkpoint. */
+    UPROPERTY(VisibleInstanceOnly, Transient, Category = "Checkpoint Settings")
+    int32 SortedIndex;
+
+    UPROPERTY(VisibleInstanceOnly, Transient, Category = "Checkpoint Settings")
+    int32 StageIndex;
+
+    friend class AS_StrafeManager;
+
     UFUNCTION() // Must be UFUNCTION to bind to overlap events
         virtual void OnTriggerOverlap(
             UPrimitiveComponent* OverlappedComponent,
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "GameModes/Strafe/S_GhostTrack.h"
+#include "S_GhostPlayback.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ * Client-only ghost of a recorded strafe run.
+ * Never replicated and never collides; it interpolates its FS_GhostTrack locally every frame,
+ * so once the track has been downloaded it costs the server nothing.
+ * Assign the mesh and a translucent material in a Blueprint subclass.
+ */
+UCLASS(Blueprintable, NotPlaceable)
+class STRAFEGAME_API AS_GhostPlayback : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AS_GhostPlayback();
+
+    //~ Begin AActor Interface
+    virtual void Tick(float DeltaSeconds) override;
+    //~ End AActor Interface
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    TObjectPtr<USkeletalMeshComponent> GhostMesh;
+
+    /** Replaces the track being played back. Playback stops until StartPlayback is called. */
+    void SetGhostTrack(FS_GhostTrack&& InTrack);
+
+    /** Restarts playback from the beginning of the run. */
+    UFUNCTION(BlueprintCallable, Category = "Ghost")
+    void StartPlayback();
+
+    /** Stops and hides the ghost. */
+    UFUNCTION(BlueprintCallable, Category = "Ghost")
+    void StopPlayback();
+
+    UFUNCTION(BlueprintPure, Category = "Ghost")
+    bool HasGhostTrack() const { return !GhostTrack.IsEmpty(); }
+
+    /** Length of the recorded run in seconds. */
+    UFUNCTION(BlueprintPure, Category = "Ghost")
+    float GetGhostDuration() const { return GhostTrack.GetDuration(); }
+
+    /** Current ghost velocity, e.g. for driving a Blueprint animation. */
+    UFUNCTION(BlueprintPure, Category = "Ghost")
+    FVector GetGhostVelocity() const { return CurrentSample.Velocity; }
+
+    /** Keep the ghost visible at its final position once the run has been played out. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Ghost")
+    bool bHoldAtFinish;
+
+protected:
+    FS_GhostTrack GhostTrack;
+
+    FS_GhostSample CurrentSample;
+
+    float PlaybackTime;
+
+    void ApplySample(const FS_GhostSample& Sample);
+};
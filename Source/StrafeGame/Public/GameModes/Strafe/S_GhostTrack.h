@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** A decoded ghost sample. Location is the racer's actor (capsule) location. */
+struct FS_GhostSample
+{
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    float Yaw = 0.0f;
+};
+
+/**
+ * Compact recording of a strafe run for ghost playback.
+ *
+ * Samples are taken at a fixed rate and quantized (1 cm position, 1 uu/s velocity, 16-bit yaw).
+ * Position is stored as the residual against a linear extrapolation of the previous sample
+ * (position + velocity * dt, no gravity term), velocity and yaw as deltas; everything is zigzag varint coded and the
+ * stream is zlib-compressed when serialized. A minute of bunny hopping at 10 Hz is a few KB.
+ *
+ * The encoder predicts from the quantized values it has already written, so decoding is exact.
+ */
+class STRAFEGAME_API FS_GhostTrack
+{
+public:
+    /** Clears the track and starts a new recording at the given sample rate. */
+    void Reset(int32 InSampleRateHz);
+
+    /** Appends and encodes one sample. Call once every 1 / SampleRate seconds. */
+    void AddSample(const FVector& Location, const FVector& Velocity, float Yaw);
+
+    /** Writes the header and the compressed sample stream. */
+    bool Serialize(TArray<uint8>& OutBytes) const;
+
+    /** Reads a serialized track and decodes it for playback. Returns false on malformed data. */
+    bool Deserialize(const TArray<uint8>& InBytes);
+
+    /**
+     * Returns the interpolated state at Time seconds into the run.
+     * Position uses cubic Hermite interpolation between samples with their velocities as tangents.
+     */
+    FS_GhostSample Evaluate(float Time) const;
+
+    float GetDuration() const { return NumSamples > 1 ? (NumSamples - 1) / static_cast<float>(SampleRateHz) : 0.0f; }
+    int32 GetNumSamples() const { return NumSamples; }
+    int32 GetSampleRateHz() const { return SampleRateHz; }
+    bool IsEmpty() const { return NumSamples == 0; }
+
+private:
+    /** Quantized state the next sample is predicted from. Shared by encoder and decoder. */
+    struct FQuantizedState
+    {
+        FIntVector Location = FIntVector::ZeroValue;
+        FIntVector Velocity = FIntVector::ZeroValue;
+        uint16 Yaw = 0;
+    };
+
+    /** Location one sample after State assuming constant velocity. */
+    static FIntVector ExtrapolateLocation(const FQuantizedState& State, int32 SampleRateHz);
+
+    static void WriteVarInt(TArray<uint8>& Stream, int32 Value);
+    static bool ReadVarInt(const TArray<uint8>& Stream, int32& Offset, int32& OutValue);
+
+    int32 SampleRateHz = 10;
+    int32 NumSamples = 0;
+
+    /** Encoded (uncompressed) sample stream. */
+    TArray<uint8> Encoded;
+
+    /** Last state written, for the encoder. */
+    FQuantizedState EncoderState;
+
+    /** Decoded samples, filled by Deserialize for playback. */
+    TArray<FS_GhostSample> Decoded;
+};
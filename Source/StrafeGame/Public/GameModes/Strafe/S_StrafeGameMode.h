@@ -55,7 +55,7 @@ protected:
     void OnWarmupTimerEnd();
 
     void StartMainMatchTimer();
-    void UpdateMainMatchTime();
+    void OnMatchTimerEnd();
 
     void StartPostMatchTimer();
     void OnPostMatchTimerEnd();
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameModes/Strafe/S_StrafePlayerState.h" // For FPlayerStrafeRaceTime
+#include "GameModes/Strafe/S_GhostTrack.h"
 #include "S_StrafeManager.generated.h"
 
 // Forward Declarations
@@ -55,14 +56,31 @@ public:
     //~ End AActor Interface
 
     /**
-     * Scans the level for all AS_CheckpointTrigger actors and registers them.
-     * Sorts them by CheckpointOrder.
-     * Identifies Start and Finish lines.
-     * Should be called by the GameMode after level loading or if checkpoints can change dynamically.
+     * Rebuilds the lap graph from the checkpoints that have registered themselves.
+     * Sorts them by CheckpointOrder, caches each checkpoint's sorted index and stage,
+     * identifies Start and Finish lines and precomputes the valid transitions.
+     * Should be called by the GameMode once the level has begun play.
      */
     UFUNCTION(BlueprintCallable, Category = "StrafeManager|Setup")
     void RefreshAndInitializeCheckpoints();
 
+    /**
+     * Registers a checkpoint with the manager. Called by AS_CheckpointTrigger::BeginPlay on the server.
+     * If the lap graph has already been built (e.g. a streamed sublevel), it is rebuilt.
+     */
+    UFUNCTION(BlueprintCallable, Category = "StrafeManager|Setup")
+    void RegisterCheckpoint(AS_CheckpointTrigger* Checkpoint);
+
+    /** Removes a checkpoint from the manager. Called by AS_CheckpointTrigger::EndPlay on the server. */
+    UFUNCTION(BlueprintCallable, Category = "StrafeManager|Setup")
+    void UnregisterCheckpoint(AS_CheckpointTrigger* Checkpoint);
+
+    /**
+     * Returns true if a racer whose last credited checkpoint is FromIndex may credit ToIndex next.
+     * Both are indices into the sorted checkpoint list. Constant time.
+     */
+    bool IsValidCheckpointTransition(int32 FromIndex, int32 ToIndex) const;
+
     /**
      * Called by an AS_CheckpointTrigger when a player overlaps it.
      * This is the primary entry point for player race progress.
@@ -86,6 +104,15 @@ public:
     UFUNCTION(BlueprintPure, Category = "StrafeManager|Scoreboard")
     const TArray<FPlayerScoreboardEntry_Strafe>& GetScoreboard() const { return Scoreboard; }
 
+    /**
+     * Seeds a player's best time from the persistent leaderboard store for the current map and checkpoint layout.
+     * Does nothing until the lap graph has been built. Server-authoritative.
+     */
+    void RestorePersistedBestTime(AS_StrafePlayerState* StrafePS);
+
+    /** Hash identifying the current checkpoint layout (orders, types, placement and laps). Leaderboards are kept per layout. */
+    uint32 GetCheckpointLayoutHash() const { return CheckpointLayoutHash; }
+
     UPROPERTY(BlueprintAssignable, Category = "StrafeManager|Events")
     FOnStrafeScoreboardUpdatedDelegate OnScoreboardUpdatedDelegate;
 
@@ -95,9 +122,26 @@ public:
     UFUNCTION(BlueprintPure, Category = "StrafeManager|Setup")
     AS_CheckpointTrigger* GetFinishLine() const { return FinishLine; }
 
+    /** Number of stages in one lap, including start and finish. Branches of the same stage count once. */
     UFUNCTION(BlueprintPure, Category = "StrafeManager|Setup")
     int32 GetTotalCheckpointsForLap() const { return TotalCheckpointsForFullLap; }
 
+    /** Number of checkpoints credited over a whole race (start, then every stage after it for each lap). */
+    UFUNCTION(BlueprintPure, Category = "StrafeManager|Setup")
+    int32 GetTotalCheckpointsForRace() const { return TotalCheckpointsForRace; }
+
+    /** Laps the current layout actually runs. Can be lower than LapsToComplete when the course cannot support multiple laps. */
+    UFUNCTION(BlueprintPure, Category = "StrafeManager|Rules")
+    int32 GetLapsToComplete() const { return ActiveLapCount; }
+
+    /** Rate at which racers are sampled for ghost recordings. 0 disables ghost recording. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "StrafeManager|Ghosts", meta = (ClampMin = "0", ClampMax = "60"))
+    int32 GhostSampleRateHz;
+
+    /** Laps required to finish a race. Multi-lap courses need at least one checkpoint between Start and Finish. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Replicated, Category = "StrafeManager|Rules", meta = (ClampMin = "1"))
+    int32 LapsToComplete;
+
 
 protected:
     /**
@@ -117,18 +161,73 @@ protected:
     UPROPERTY(BlueprintReadOnly, Transient, Category = "StrafeManager|Setup")
     TObjectPtr<AS_CheckpointTrigger> FinishLine;
 
-    /** Includes start and finish line checkpoints. Set after RefreshAndInitializeCheckpoints. */
+    /** Includes start and finish line checkpoints. Set after RefreshAndInitializeCheckpoints. Replicated for the HUD. */
+    UPROPERTY(Replicated)
     int32 TotalCheckpointsForFullLap;
 
+    /** Progress points over all laps. Set after RefreshAndInitializeCheckpoints. Replicated for the HUD. */
+    UPROPERTY(Replicated)
+    int32 TotalCheckpointsForRace;
+
+    /** LapsToComplete as validated against the layout in FinalizeCheckpointSetup. Replicated for the HUD. */
+    UPROPERTY(Replicated)
+    int32 ActiveLapCount;
+
+    /**
+     * Flattened NumCheckpoints x NumCheckpoints adjacency matrix of the lap graph (server only).
+     * Bit (From * NumCheckpoints + To) is set when To is a valid next checkpoint after From.
+     */
+    TBitArray<> TransitionTable;
+
+    /** True once RefreshAndInitializeCheckpoints has built the lap graph. Late registrations trigger a rebuild. */
+    bool bCheckpointGraphBuilt;
+
+    /** See GetCheckpointLayoutHash. Computed in FinalizeCheckpointSetup. */
+    uint32 CheckpointLayoutHash;
+
     UFUNCTION()
     virtual void OnRep_Scoreboard();
 
-    /** Sorts the AllCheckpointsInOrder array by CheckpointOrder. */
+    /** Sorts the AllCheckpointsInOrder array by CheckpointOrder, then type and placement, so the order is deterministic. */
     void SortCheckpoints();
 
-    /** After sorting, identifies StartLine, FinishLine, and TotalCheckpointsForFullLap. */
+    /** After sorting, caches checkpoint indices and identifies StartLine, FinishLine, and TotalCheckpointsForFullLap. */
     void FinalizeCheckpointSetup();
 
-    /** Registers a single checkpoint. Called by RefreshAndInitializeCheckpoints. */
-    void RegisterCheckpoint(AS_CheckpointTrigger* Checkpoint);
+    /** Precomputes TransitionTable from the sorted checkpoints, their stages and NextCheckpoints overrides. */
+    void BuildLapGraph(int32 NumStages);
+
+    /** Credits the checkpoint at NodeIndex to the racer, finishing the race if it is the final progress point. */
+    void CreditCheckpoint(AS_StrafePlayerState* StrafePS, int32 NodeIndex, bool bIsFinishLine);
+
+    /** Writes a finished race to the persistent leaderboard store. Returns the new record id, or 0 if it was not a personal best. */
+    uint64 SubmitToLeaderboardStore(AS_StrafePlayerState* StrafePS) const;
+
+    // --- Ghost recording (server) ---
+    /** Active recordings, one per racer currently on a run. */
+    TMap<TWeakObjectPtr<AS_StrafePlayerState>, FS_GhostTrack> GhostRecordings;
+
+    /** Drives SampleGhostRecordings while any recording is active. */
+    FTimerHandle GhostSampleTimerHandle;
+
+    /** (Re)starts recording a racer's run from their current position. */
+    void StartGhostRecording(AS_StrafePlayerState* StrafePS);
+
+    /** Appends the current pawn state of every active recording. */
+    void SampleGhostRecordings();
+
+    /** Adds one sample for a racer. Returns false if the racer no longer has a pawn. */
+    static bool AddGhostSample(AS_StrafePlayerState* StrafePS, FS_GhostTrack& Track);
+
+    /** Ends a racer's recording. If RecordId is set, the ghost is saved next to that leaderboard record and sent to the racer. */
+    void FinishGhostRecording(AS_StrafePlayerState* StrafePS, uint64 RecordId);
+
+    /** Loads the ghost saved next to a leaderboard record and sends it to the racer. */
+    void SendPersistedGhost(AS_StrafePlayerState* StrafePS, uint64 RecordId) const;
+
+    /** Returns the map name leaderboards are filed under (PIE prefix stripped). */
+    FString GetLeaderboardMapName() const;
+
+    /** Returns the stable id a player's times are stored under. */
+    static FString GetLeaderboardPlayerId(const AS_StrafePlayerState* StrafePS);
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "Delegates/DelegateCombinations.h"
 #include "S_StrafePlayerState.generated.h"
 
+class AS_GhostPlayback;
+
 USTRUCT(BlueprintType)
 struct FPlayerStrafeRaceTime
 {
@@ -41,6 +43,7 @@ public:
     virtual void Tick(float DeltaSeconds) override;
     virtual void Reset() override;
     virtual void CopyProperties(APlayerState* PlayerState) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     UFUNCTION(BlueprintCallable, Category = "StrafePlayerState|Race", meta = (DisplayName = "Start Race (Server)"))
     void ServerStartRace();
@@ -54,6 +57,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "StrafePlayerState|Race", meta = (DisplayName = "Reset Race State (Server)"))
     void ServerResetRaceState();
 
+    /** Server only. Adopts a best time loaded from persistent storage if it beats the one held in memory. */
+    void ServerRestoreBestRaceTime(const FPlayerStrafeRaceTime& InBestRaceTime);
+
+    /**
+     * Delivers the serialized ghost of this player's personal best (an FS_GhostTrack).
+     * The ghost is then played back locally each time a race starts, with no further network traffic.
+     */
+    UFUNCTION(Client, Reliable)
+    void ClientReceiveGhost(const TArray<uint8>& GhostData);
+
+    /** Ghost actor spawned locally for personal best playback. */
+    UPROPERTY(EditDefaultsOnly, Category = "StrafePlayerState|Ghost")
+    TSubclassOf<AS_GhostPlayback> GhostPlaybackClass;
+
     UFUNCTION(BlueprintPure, Category = "StrafePlayerState|Race")
     float GetCurrentRaceTime() const { return CurrentRaceTime; }
 
@@ -72,6 +89,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "StrafePlayerState|Race")
     bool IsRaceInProgress() const { return bIsRaceActiveForPlayer; }
 
+    /** Server only. Sorted index (in the StrafeManager's lap graph) of the checkpoint last credited, or INDEX_NONE. */
+    int32 GetLastCheckpointNode() const { return LastCheckpointNode; }
+
+    /** Server only. Called by the StrafeManager after crediting a checkpoint, so branch choices can be validated. */
+    void SetLastCheckpointNode(int32 NodeIndex) { LastCheckpointNode = NodeIndex; }
+
     UPROPERTY(BlueprintAssignable, Category = "StrafePlayerState|Events")
     FOnStrafePlayerRaceStateChangedDelegate OnStrafePlayerRaceStateChangedDelegate;
 
@@ -106,6 +129,20 @@ protected:
     UPROPERTY(Transient, ReplicatedUsing = OnRep_IsRaceActiveForPlayer)
     bool bIsRaceActiveForPlayer;
 
+    /**
+     * Bumped by every ServerStartRace. A restart within one net update leaves bIsRaceActiveForPlayer true on
+     * both ends, so clients key race-start reactions (ghost restart, RaceStarted event) off this counter instead.
+     */
+    UPROPERTY(Transient, ReplicatedUsing = OnRep_RaceStartCount)
+    uint8 RaceStartCount;
+
+    /** Not replicated; only the server validates checkpoint transitions. */
+    int32 LastCheckpointNode;
+
+    /** Local ghost of the personal best. Only exists on the owning client. */
+    UPROPERTY(Transient)
+    TObjectPtr<AS_GhostPlayback> GhostPlayback;
+
     UFUNCTION()
     void OnRep_CurrentRaceTime();
     UFUNCTION()
@@ -118,6 +155,8 @@ protected:
     void OnRep_LastCheckpointReached();
     UFUNCTION()
     void OnRep_IsRaceActiveForPlayer();
+    UFUNCTION()
+    void OnRep_RaceStartCount();
 
     void BroadcastStrafeStateUpdate();
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "GameFramework/PlayerState.h"
 #include "AbilitySystemInterface.h"    // For IAbilitySystemInterface
 #include "GameplayEffectTypes.h"       // For FOnAttributeChangeData
+#include "GameplayTagContainer.h"
 #include "Delegates/DelegateCombinations.h"
 #include "S_PlayerState.generated.h"
 
@@ -58,6 +59,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "PlayerState|Status")
     bool IsPlayerDead() const { return bIsDead; }
 
+    /**
+     * Called by the GameMode on the outgoing PlayerState right before a seamless travel hands it over.
+     * The engine resets the old PlayerState before copying it, so Reset is skipped from here on
+     * and CopyProperties sees the state the player actually had.
+     */
+    void PrepareForSeamlessTravel() { bPreservingStateForTravel = true; }
+
 protected:
     /** The AbilitySystemComponent for this PlayerState. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PlayerState|GAS", meta = (AllowPrivateAccess = "true"))
@@ -78,9 +86,22 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PlayerState|GAS|Defaults", meta = (DisplayName = "Default Player-Owned Abilities"))
     TArray<TSubclassOf<UGameplayAbility>> DefaultPlayerAbilities;
 
+    /**
+     * Infinite-duration effects carrying any of these asset tags (e.g. cosmetics, unlocks, progression)
+     * are re-applied to the new PlayerState on seamless travel. Everything else starts fresh each match.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PlayerState|GAS|Travel")
+    FGameplayTagContainer PersistentEffectTags;
+
     virtual void InitializeAttributes();
     virtual void GrantDefaultAbilities();
 
+    /** Re-grants runtime abilities and re-applies persistent effects on the ASC of the PlayerState replacing this one. */
+    virtual void CopyAbilitySystemState(AS_PlayerState* TargetPlayerState) const;
+
+    /** True once this PlayerState is being handed over by seamless travel; see PrepareForSeamlessTravel. */
+    bool bPreservingStateForTravel;
+
     // --- ATTRIBUTE CHANGE HANDLING ---
     FDelegateHandle HealthChangedDelegateHandle;
 
@@ -42,6 +42,15 @@ public:
 
 
 protected:
+    enum EArenaDirtyField : uint32
+    {
+        DirtyScore = 1 << 8,
+        DirtyKillfeed = 1 << 9,
+    };
+
+    // Rescans the leader and rebuilds the killfeed at most once per frame, however many score or kill events arrived.
+    virtual void FlushDirtyFields(uint32 DirtyFields) override;
+
     TWeakObjectPtr<AS_ArenaGameState> ArenaGameState;
     TWeakObjectPtr<AS_ArenaPlayerState> LocalArenaPlayerState;
 
@@ -27,6 +27,16 @@ public:
     FOnGameModeViewModelUpdated OnGameModeViewModelUpdated;
 
 protected:
+    // Dirty fields, flushed once per frame by FlushDirtyFields. Game mode subclasses use bits from 8 up.
+    enum EDirtyField : uint32
+    {
+        DirtyMatchState = 1 << 0,
+        DirtyRemainingTime = 1 << 1,
+    };
+
+    // Broadcasts OnGameModeViewModelUpdated once. Subclasses refresh their derived data first, then call Super.
+    virtual void FlushDirtyFields(uint32 DirtyFields) override;
+
     TWeakObjectPtr<AS_GameStateBase> GameStateBase;
 
     // FDelegateHandle MatchStateChangedHandle; // Not needed for AddDynamic
@@ -0,0 +1,37 @@
+// Source/StrafeGame/Public/UI/ViewModels/S_HUDUpdateScheduler.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class US_ViewModelBase;
+
+/**
+ * Coalesces HUD view model notifications into one flush per frame.
+ *
+ * View models mark fields dirty from their model callbacks (US_ViewModelBase::MarkFieldsDirty) instead of
+ * broadcasting to widgets. Just before Slate ticks, after the game world has run, every dirty view model gets
+ * one FlushDirtyFields call with the union of its fields, so a rocket hit that changes health, armor and ammo
+ * refreshes each widget once rather than once per attribute.
+ *
+ * A view model flushes at most once per frame. View models dirtied by another's flush (the player HUD updating
+ * its weapon view models) are handled in the same pass; one dirtied again after its own flush waits a frame.
+ */
+class STRAFEGAME_API FS_HUDUpdateScheduler
+{
+public:
+    static FS_HUDUpdateScheduler& Get();
+
+    /** Queues a view model whose fields just became dirty. Flushes immediately when there is no Slate to tick. */
+    void Schedule(US_ViewModelBase* ViewModel);
+
+private:
+    void Flush(float DeltaTime);
+
+    /** View models waiting for this frame's flush, in the order they were dirtied. */
+    TArray<TWeakObjectPtr<US_ViewModelBase>> PendingViewModels;
+
+    /** View models that were already flushed this frame; they move to PendingViewModels for the next one. */
+    TArray<TWeakObjectPtr<US_ViewModelBase>> DeferredViewModels;
+
+    FDelegateHandle PreTickHandle;
+};
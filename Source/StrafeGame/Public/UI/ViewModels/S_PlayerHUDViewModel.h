@@ -54,6 +54,16 @@ public:
     FOnViewModelUpdated OnViewModelUpdated;
 
 protected:
+    // Dirty fields, flushed once per frame by FlushDirtyFields.
+    enum EDirtyField : uint32
+    {
+        DirtyHealth = 1 << 0,
+        DirtyArmor = 1 << 1,
+        DirtyWeapons = 1 << 2,
+    };
+
+    virtual void FlushDirtyFields(uint32 DirtyFields) override;
+
     // Cached references to Model components
     UPROPERTY()
     TWeakObjectPtr<US_AttributeSet> PlayerAttributeSet;
@@ -64,6 +74,15 @@ protected:
     UPROPERTY()
     TWeakObjectPtr<US_WeaponInventoryComponent> WeaponInventoryComponent;
 
+    // Live weapon view models keyed by the weapon they represent. WeaponInventoryViewModels holds the same
+    // objects in inventory order.
+    UPROPERTY()
+    TMap<TWeakObjectPtr<AS_Weapon>, TObjectPtr<US_WeaponViewModel>> WeaponViewModelsByWeapon;
+
+    // Deinitialized weapon view models waiting for reuse. Matched by exact class on acquire.
+    UPROPERTY()
+    TArray<TObjectPtr<US_WeaponViewModel>> PooledWeaponViewModels;
+
     // Delegate handles for attribute changes
     FDelegateHandle HealthChangedDelegateHandle;
     FDelegateHandle MaxHealthChangedDelegateHandle;
@@ -78,6 +97,11 @@ protected:
     void UpdateWeaponInventory();
     void UpdateEquippedWeapon();
 
+    // Weapon view model pooling. Released view models are deinitialized and kept for the next weapon
+    // that uses the same WeaponViewModelClass, so pickups and respawns don't allocate new ones.
+    US_WeaponViewModel* AcquireWeaponViewModel(TSubclassOf<US_WeaponViewModel> ViewModelClass);
+    void ReleaseWeaponViewModel(US_WeaponViewModel* WeaponVM);
+
     // Callbacks for attribute changes
     virtual void HandleHealthChanged(const FOnAttributeChangeData& Data);
     virtual void HandleMaxHealthChanged(const FOnAttributeChangeData& Data);
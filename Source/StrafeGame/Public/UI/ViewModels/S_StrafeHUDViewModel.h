@@ -39,6 +39,14 @@ public:
     bool bIsRaceActive;
 
 protected:
+    enum EStrafeDirtyField : uint32
+    {
+        DirtyRaceState = 1 << 8,
+    };
+
+    // Copies the race state (split arrays included) at most once per frame.
+    virtual void FlushDirtyFields(uint32 DirtyFields) override;
+
     TWeakObjectPtr<AS_StrafeGameState> StrafeGameState;
     TWeakObjectPtr<AS_StrafePlayerState> LocalStrafePlayerState;
 
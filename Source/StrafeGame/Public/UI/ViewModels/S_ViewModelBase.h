@@ -33,4 +33,24 @@ protected:
 
     // Helper to get the PlayerController safely.
     AS_PlayerController* GetOwningPlayerController() const;
+
+    // Records that the given fields (a ViewModel-defined bitmask) changed. Instead of broadcasting to views
+    // right away, the ViewModel is flushed once at the end of the frame with every field marked since.
+    void MarkFieldsDirty(uint32 Fields);
+
+    // Called by FS_HUDUpdateScheduler at most once per frame. Recompute derived values for DirtyFields and
+    // broadcast to views here.
+    virtual void FlushDirtyFields(uint32 DirtyFields) {}
+
+private:
+    friend class FS_HUDUpdateScheduler;
+
+    // Clears the pending fields and hands them to FlushDirtyFields.
+    void FlushPendingFields();
+
+    // Fields marked since the last flush. Non-zero means the ViewModel is queued with the scheduler.
+    uint32 PendingDirtyFields = 0;
+
+    // GFrameCounter of the last flush, so a ViewModel is never flushed twice in one frame.
+    uint64 LastFlushFrame = 0;
 };
\ No newline at end of file
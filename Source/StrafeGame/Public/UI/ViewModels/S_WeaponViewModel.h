@@ -59,6 +59,17 @@ public:
     FOnWeaponViewModelUpdated OnWeaponViewModelUpdated;
 
 protected:
+    // Dirty fields, flushed once per frame by FlushDirtyFields.
+    enum EDirtyField : uint32
+    {
+        DirtyAmmo = 1 << 0,
+        DirtyEquipped = 1 << 1,
+        DirtyWeaponState = 1 << 2, // Weapon-specific state added by subclasses (charge, active projectiles, ...)
+    };
+
+    // Broadcasts OnWeaponViewModelUpdated once for everything that changed this frame.
+    virtual void FlushDirtyFields(uint32 DirtyFields) override;
+
     UPROPERTY()
     TWeakObjectPtr<AS_Weapon> WeaponActor;
 